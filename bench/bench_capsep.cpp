@@ -0,0 +1,84 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: bench_capsep.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Scaling of CAPSEP_SeparateCapCuts with the number of customers.
+ * With the sparse XMatrix/SMatrix a call costs O(n + edges) memory; the
+ * dense matrices it replaced are shown for comparison.
+ *
+ * Usage: bench_capsep [max # of customers (default 1600)] [fraction of the
+ * customers visited (default 0.2)]
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 11:05 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+
+#include "../include/callback/capacity_separator.hpp"
+#include "../include/ext/cvrpsep/cnstrmgr.h"
+
+#include "bench_utils.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+static const int cMaxNbCuts = 8;
+static const int cNbGraphs = 5; // graphs (random seeds) per size
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+    const int maxN = argc > 1 ? std::atoi(argv[1]) : 1600;
+    const double visited = argc > 2 ? std::atof(argv[2]) : 0.2;
+
+    std::printf("%8s %8s %12s %12s %16s\n", "n", "edges", "ms/call",
+                "cuts/call", "dense XM+SM (MB)");
+
+    for (int n = 50; n <= maxN; n *= 2)
+    {
+        std::mt19937 rng(n);
+        double ms = 0, nbCuts = 0, nbEdges = 0;
+        for (int g = 0; g < cNbGraphs; ++g)
+        {
+            auto sg = bench::randomSupportGraph(n, visited, rng);
+            nbEdges += sg.nbEdges();
+
+            CnstrMgrPointer oldCuts;
+            CMGR_CreateCMgr(&oldCuts, 1);
+
+            /* as in the callback: reusable separator, spans over the
+               support graph vectors */
+            CapacitySeparator sep(cMaxNbCuts, 1e-4);
+            auto separate = [&]()
+            {
+                return sep.separate(n, sg.cap, sg.demand, sg.tail, sg.head,
+                                    sg.x, oldCuts).size();
+            };
+
+            nbCuts += separate();
+            ms += bench::meanTimeMs(separate, 1, 100);
+
+            CMGR_FreeMemCMgr(&oldCuts);
+        }
+
+        const double denseMB = 2.0 * (n + 2) * (n + 2) * sizeof(double) / 1e6;
+        std::printf("%8d %8.0f %12.3f %12.1f %16.1f\n", n,
+                    nbEdges / cNbGraphs, ms / cNbGraphs,
+                    nbCuts / cNbGraphs,
+                    denseMB);
+    }
+
+    return 0;
+}
@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: bench_cmgr.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Long-lived pools of capacity cuts (CVRPSEP constraint managers), as
+ * the CutPool of the callback: each offered cut is looked up and added if it
+ * is new. The hash index of the constraint manager (CMGR_AddCnstr) against
+ * the linear scan of CMGR_SearchCap it replaced. Both must find the same
+ * repeated cuts.
+ *
+ * Usage: bench_cmgr [max pool size (default 32000)] [# of customers (default
+ * 200)]
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 18, 2026, 01:10 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "../include/ext/cvrpsep/cnstrmgr.h"
+
+#include "bench_utils.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+// fraction of the offered cuts that repeat a cut offered before
+static const double cRepeated = 0.3;
+
+/* Sorted customer sets (IntList[1..size], position 0 unused) offered to the
+   pool: new random sets of 2 to n / 4 customers, or repeated ones. */
+std::vector<std::vector<int>> offeredCuts(const int nbOffers,
+                                          const int n,
+                                          std::mt19937& rng)
+{
+    std::vector<int> customers(n);
+    for (int i = 0; i < n; ++i)
+    {
+        customers[i] = i + 1;
+    }
+
+    std::uniform_real_distribution<double> coin(0, 1);
+    std::uniform_int_distribution<int> size(2, std::max(2, n / 4));
+
+    std::vector<std::vector<int>> offers;
+    offers.reserve(nbOffers);
+    for (int o = 0; o < nbOffers; ++o)
+    {
+        if (!offers.empty() && coin(rng) < cRepeated)
+        {
+            std::uniform_int_distribution<int> prev(0, offers.size() - 1);
+            offers.push_back(offers[prev(rng)]);
+            continue;
+        }
+
+        std::shuffle(customers.begin(), customers.end(), rng);
+        std::vector<int> list(1, 0);
+        list.insert(list.end(), customers.begin(),
+                    customers.begin() + size(rng));
+        std::sort(list.begin() + 1, list.end());
+        offers.push_back(std::move(list));
+    }
+
+    return offers;
+}
+
+/* CMGR_SearchCap before the hash index: compares the list with every
+   capacity cut of the manager */
+bool linearSearchCap(CnstrMgrPointer cmp, const std::vector<int>& list)
+{
+    const int size = static_cast<int>(list.size()) - 1;
+    for (int c = 0; c < cmp->Size; ++c)
+    {
+        if (cmp->CPL[c]->CType != CMGR_CT_CAP) continue;
+        if (cmp->CPL[c]->IntListSize != size) continue;
+
+        if (std::equal(list.begin() + 1, list.end(),
+                       cmp->CPL[c]->IntList + 1))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/* offers all cuts to an empty pool; returns the number of repeated ones */
+int fillPool(const std::vector<std::vector<int>>& offers, const bool hashed)
+{
+    CnstrMgrPointer cmp;
+    CMGR_CreateCMgr(&cmp, 100);
+
+    int nbHits = 0;
+    for (const auto& list : offers)
+    {
+        auto intList = const_cast<int*>(list.data());
+        const int size = static_cast<int>(list.size()) - 1;
+        if (hashed)
+        {
+            const int sizeBefore = cmp->Size;
+            CMGR_AddCnstr(cmp, CMGR_CT_CAP, 0, size, intList, size - 1);
+            nbHits += cmp->Size == sizeBefore;
+        }
+        else if (linearSearchCap(cmp, list))
+        {
+            ++nbHits;
+        }
+        else
+        {
+            /* CMGR_AddExtCnstr() adds without looking the cut up */
+            CMGR_AddExtCnstr(cmp, CMGR_CT_CAP, 0, size, intList, 0, nullptr,
+                             size - 1);
+        }
+    }
+
+    CMGR_FreeMemCMgr(&cmp);
+
+    return nbHits;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+    const int maxSize = argc > 1 ? std::atoi(argv[1]) : 32000;
+    const int n = argc > 2 ? std::atoi(argv[2]) : 200;
+
+    std::printf("%8s %8s | %12s %12s %8s | %s\n", "offers", "cuts",
+                "linear (ms)", "hashed (ms)", "", "repeated cuts");
+
+    for (int nbOffers = 1000; nbOffers <= maxSize; nbOffers *= 2)
+    {
+        std::mt19937 rng(nbOffers);
+        const auto offers = offeredCuts(nbOffers, n, rng);
+
+        const int linearHits = fillPool(offers, false);
+        const int hashedHits = fillPool(offers, true);
+
+        const double linearMs = bench::meanTimeMs(
+            [&]() {fillPool(offers, false);}, 1, 50);
+        const double hashedMs = bench::meanTimeMs(
+            [&]() {fillPool(offers, true);}, 1, 50);
+
+        std::printf("%8d %8d | %12.3f %12.3f %7.1fx | %d %s\n", nbOffers,
+                    nbOffers - hashedHits, linearMs, hashedMs,
+                    linearMs / hashedMs, hashedHits,
+                    linearHits == hashedHits ? "(same)" : "(DIFFERENT)");
+    }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: bench_grsearch.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Greedy capacity cuts search of CVRPSEP (GRSEARCH_CapCuts) on
+ * unshrunk support graphs, with and without violated cuts (in the last case
+ * the search grows a set from every customer). The target bench_grsearch
+ * finds the anti-sets with their prefix table (GRSEARCH_PREFIX_TABLE=1) and
+ * bench_grsearch_scan by testing all of them; both must print the same
+ * checksums.
+ *
+ * Usage: bench_grsearch[_scan] [max # of customers (default 400)] [fraction
+ * of the customers visited (default 1)]
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 18, 2026, 02:30 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../include/ext/cvrpsep/basegrph.h"
+#include "../include/ext/cvrpsep/cnstrmgr.h"
+#include "../include/ext/cvrpsep/csrgraph.h"
+#include "../include/ext/cvrpsep/spmatrix.h"
+#include "../include/ext/cvrpsep/grsearch.h"
+
+#include "bench_utils.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+static const int cNbGraphs = 5; // graphs (random seeds) per size
+
+// capacity factor that makes every set feasible (no violated cut)
+static const int cNoCutsCapFactor = 100;
+
+/* GRSEARCH_CapCuts on the graph, every customer a supernode (as when
+   nothing is shrunk), up to n cuts. Returns a checksum of the cuts and of
+   the anti-sets. */
+long greedySearch(const bench::SupportGraph& g, const int capFactor)
+{
+    const int n = g.n;
+
+    /* CVRPSEP arrays are 1-based (the depot n + 1 has no demand) */
+    std::vector<int> tail(1, 0), head(1, 0), demand(1, 0);
+    tail.insert(tail.end(), g.tail.begin(), g.tail.end());
+    head.insert(head.end(), g.head.begin(), g.head.end());
+    demand.insert(demand.end(), g.demand.begin(), g.demand.end());
+    demand.push_back(0);
+
+    CSRGraphPtr support;
+    CSR_CreateFromEdges(&support, n + 1, g.nbEdges(), tail.data(),
+                        head.data());
+
+    SparseMatrixPtr xMatrix;
+    SPM_InitMem(&xMatrix, n + 1, 2 * g.nbEdges());
+    SPM_Clear(xMatrix, n + 1);
+    for (int e = 0; e < g.nbEdges(); ++e)
+    {
+        SPM_AddSym(xMatrix, g.tail[e], g.head[e], g.x[e]);
+    }
+    SPM_Finish(xMatrix);
+
+    std::vector<int> superNodeSize(n + 1, 1);
+    std::vector<double> xInSuperNode(n + 1, 0);
+
+    ReachPtr sets, antiSets;
+    ReachInitMem(&sets, 2 * n);
+    ReachInitMem(&antiSets, 2 * n);
+
+    int nbSets = 0, nbAntiSets = 0;
+    GRSEARCH_CapCuts(support, n, demand.data(), g.cap * capFactor,
+                     superNodeSize.data(), xInSuperNode.data(), xMatrix,
+                     &nbSets, &nbAntiSets, sets, antiSets, n);
+
+    long checksum = nbSets * 1000003L + nbAntiSets;
+    for (const auto& r : {std::make_pair(sets, nbSets),
+                          std::make_pair(antiSets, nbAntiSets)})
+    {
+        for (int s = 1; s <= r.second; ++s)
+        {
+            for (int k = 1; k <= r.first->LP[s].CFN; ++k)
+            {
+                checksum = checksum * 31 + r.first->LP[s].FAL[k] * k;
+            }
+        }
+    }
+
+    ReachFreeMem(&sets);
+    ReachFreeMem(&antiSets);
+    SPM_FreeMem(&xMatrix);
+    CSR_FreeMem(&support);
+
+    return checksum;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+    const int maxN = argc > 1 ? std::atoi(argv[1]) : 400;
+    const double visited = argc > 2 ? std::atof(argv[2]) : 1;
+
+    std::printf("%7s | %-32s | %-32s\n", "", "with violated cuts",
+                "without violated cuts");
+    std::printf("%7s | %10s %21s | %10s %21s\n", "n", "ms/call", "checksum",
+                "ms/call", "checksum");
+
+    for (int n = 50; n <= maxN; n *= 2)
+    {
+        std::mt19937 rng(n);
+        std::vector<bench::SupportGraph> graphs;
+        for (int g = 0; g < cNbGraphs; ++g)
+        {
+            graphs.push_back(bench::randomSupportGraph(n, visited, rng));
+        }
+
+        std::printf("%7d", n);
+        for (const int capFactor : {1, cNoCutsCapFactor})
+        {
+            long checksum = 0;
+            double ms = 0;
+            for (const auto& g : graphs)
+            {
+                checksum ^= greedySearch(g, capFactor);
+                ms += bench::meanTimeMs(
+                    [&]() {greedySearch(g, capFactor);}, 1, 50);
+            }
+            std::printf(" | %10.3f %21ld", ms / cNbGraphs, checksum);
+        }
+        std::printf("\n");
+    }
+
+    return 0;
+}
@@ -0,0 +1,284 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: bench_mxf.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief CVRPSEP max flow package against its version before the forward
+ * star rewrite (mxf_legacy.cpp), on the two ways the separation uses it: the
+ * FCAPFIX sequence (one max flow, then one warm started max flow per seed
+ * customer with some capacities changed) and the Gomory-Hu cut trees of the
+ * exact SEC separation. Both engines must give the same cuts.
+ *
+ * Usage: bench_mxf [max # of customers (default 800) | file of recorded
+ * support graphs (see bench::readSupportGraphs)] [fraction of the customers
+ * visited (default 0.2)]
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 11:50 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../include/ext/cvrpsep/mxf.h"
+
+#include "bench_utils.hpp"
+#include "mxf_legacy.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+static const int cNbGraphs = 5; // graphs (random seeds) per size
+
+// max flow capacities of the GH trees: x_e * cFlowScale (as in exact_sec)
+static const double cFlowScale = 1e4;
+
+/* the max flow routines of one implementation */
+struct Engine
+{
+    decltype(&::MXF_InitMem) initMem;
+    decltype(&::MXF_FreeMem) freeMem;
+    decltype(&::MXF_ClearNodeList) clearNodeList;
+    decltype(&::MXF_ClearArcList) clearArcList;
+    decltype(&::MXF_SetNodeListSize) setNodeListSize;
+    decltype(&::MXF_AddArc) addArc;
+    decltype(&::MXF_ChgArcCap) chgArcCap;
+    decltype(&::MXF_CreateMates) createMates;
+    decltype(&::MXF_CreateArcMap) createArcMap;
+    decltype(&::MXF_SolveMaxFlow) solveMaxFlow;
+    decltype(&::MXF_GetNetworkSize) getNetworkSize;
+    decltype(&::MXF_GetCurrentFlow) getCurrentFlow;
+    decltype(&::MXF_SetFlow) setFlow;
+    decltype(&::MXF_ComputeGHCutTree) computeGHCutTree;
+};
+
+static const Engine cCurrent = {
+    ::MXF_InitMem, ::MXF_FreeMem, ::MXF_ClearNodeList, ::MXF_ClearArcList,
+    ::MXF_SetNodeListSize, ::MXF_AddArc, ::MXF_ChgArcCap, ::MXF_CreateMates,
+    ::MXF_CreateArcMap, ::MXF_SolveMaxFlow, ::MXF_GetNetworkSize,
+    ::MXF_GetCurrentFlow, ::MXF_SetFlow, ::MXF_ComputeGHCutTree};
+
+static const Engine cLegacy = {
+    legacy::MXF_InitMem, legacy::MXF_FreeMem, legacy::MXF_ClearNodeList,
+    legacy::MXF_ClearArcList, legacy::MXF_SetNodeListSize, legacy::MXF_AddArc,
+    legacy::MXF_ChgArcCap, legacy::MXF_CreateMates, legacy::MXF_CreateArcMap,
+    legacy::MXF_SolveMaxFlow, legacy::MXF_GetNetworkSize,
+    legacy::MXF_GetCurrentFlow, legacy::MXF_SetFlow,
+    legacy::MXF_ComputeGHCutTree};
+
+/* The network of FCAPFIX_ComputeCuts (customers 1..n, source n + 1, sink
+   n + 2), its max flow, then one max flow per customer fixed on the sink
+   side, each started from the first flow. Returns a checksum of the cuts. */
+long fcapfixSequence(const Engine& mxf, const bench::SupportGraph& g)
+{
+    const int n = g.n;
+    const int source = n + 1;
+    const int sink = n + 2;
+
+    int vcap = g.cap, flowScale = 1;
+    while (vcap < 1000)
+    {
+        vcap *= 10;
+        flowScale *= 10;
+    }
+
+    MaxFlowPtr p;
+    mxf.initMem(&p, n + 2, 5 * (n + 2));
+    mxf.clearNodeList(p);
+    mxf.setNodeListSize(p, n + 2);
+    mxf.clearArcList(p);
+
+    std::vector<double> depotX(n + 1, 0);
+    for (int e = 0; e < g.nbEdges(); ++e)
+    {
+        if (g.tail[e] == n + 1 || g.head[e] == n + 1)
+        {
+            depotX[g.tail[e] + g.head[e] - n - 1] = g.x[e];
+            continue;
+        }
+        const int cap = static_cast<int>(g.x[e] * vcap + 1);
+        mxf.addArc(p, g.tail[e], g.head[e], cap);
+        mxf.addArc(p, g.head[e], g.tail[e], cap);
+    }
+
+    int infCap = 2 * vcap;
+    std::vector<int> capToSink(n + 1, 0);
+    for (int k = 1; k <= n; ++k)
+    {
+        const int x = static_cast<int>(depotX[k] * vcap + 1 -
+                                       2 * flowScale * g.demand[k - 1]);
+        if (x > 0)
+        {
+            infCap += x;
+            mxf.addArc(p, source, k, x);
+            mxf.addArc(p, k, sink, 0);
+        }
+        else
+        {
+            capToSink[k] = -x;
+            mxf.addArc(p, k, sink, -x);
+            mxf.addArc(p, source, k, 0);
+        }
+    }
+    mxf.createMates(p);
+
+    std::vector<int> nodeList(n + 3);
+    int cutValue, size;
+    mxf.solveMaxFlow(p, 1, source, sink, &cutValue, 1, &size,
+                     nodeList.data());
+    mxf.createArcMap(p);
+
+    int nodes, arcs;
+    mxf.getNetworkSize(p, &nodes, &arcs);
+    std::vector<int> residual(arcs + 1), excess(nodes + 1);
+    mxf.getCurrentFlow(p, residual.data(), excess.data());
+
+    long checksum = 0;
+    for (int seed = 1; seed <= n; ++seed)
+    {
+        if (g.demand[seed - 1] == 0) continue;
+
+        mxf.setFlow(p, residual.data(), excess.data());
+        mxf.chgArcCap(p, seed, sink, infCap);
+        mxf.solveMaxFlow(p, 0, source, sink, &cutValue, 1, &size,
+                         nodeList.data());
+        mxf.chgArcCap(p, seed, sink, capToSink[seed]);
+
+        for (int i = 1; i <= size; ++i)
+        {
+            checksum += nodeList[i] * static_cast<long>(seed);
+        }
+    }
+
+    mxf.freeMem(p);
+
+    return checksum;
+}
+
+/* The Gomory-Hu cut tree of the support graph rooted at the depot, as in
+   CallbackSEC::addExactSEC(). Returns a checksum of the tree. */
+long ghCutTree(const Engine& mxf, const bench::SupportGraph& g)
+{
+    const int n = g.n + 1;
+
+    MaxFlowPtr p;
+    mxf.initMem(&p, n, 2 * g.nbEdges());
+    mxf.clearNodeList(p);
+    mxf.setNodeListSize(p, n);
+    mxf.clearArcList(p);
+    for (int e = 0; e < g.nbEdges(); ++e)
+    {
+        const int cap = static_cast<int>(std::lround(g.x[e] * cFlowScale));
+        mxf.addArc(p, g.tail[e], g.head[e], cap);
+        mxf.addArc(p, g.head[e], g.tail[e], cap);
+    }
+    mxf.createMates(p);
+
+    std::vector<int> cutValue(n + 1), nextOnPath(n + 1);
+    mxf.computeGHCutTree(p, n, cutValue.data(), nextOnPath.data());
+    mxf.freeMem(p);
+
+    long checksum = 0;
+    for (int i = 1; i <= n; ++i)
+    {
+        checksum += (cutValue[i] + 7L * nextOnPath[i]) * i;
+    }
+
+    return checksum;
+}
+
+/* one line of the table: mean times (ms per graph) of both engines */
+void benchGraphs(const std::vector<bench::SupportGraph>& graphs)
+{
+    double n = 0, nbEdges = 0;
+    double fcapLegacy = 0, fcapCurrent = 0, ghLegacy = 0, ghCurrent = 0;
+    bool same = true;
+    for (const auto& g : graphs)
+    {
+        n += g.n;
+        nbEdges += g.nbEdges();
+
+        same = same && fcapfixSequence(cLegacy, g) ==
+                       fcapfixSequence(cCurrent, g);
+        same = same && ghCutTree(cLegacy, g) == ghCutTree(cCurrent, g);
+
+        fcapLegacy += bench::meanTimeMs(
+            [&]() {fcapfixSequence(cLegacy, g);}, 1, 50);
+        fcapCurrent += bench::meanTimeMs(
+            [&]() {fcapfixSequence(cCurrent, g);}, 1, 50);
+        ghLegacy += bench::meanTimeMs(
+            [&]() {ghCutTree(cLegacy, g);}, 1, 50);
+        ghCurrent += bench::meanTimeMs(
+            [&]() {ghCutTree(cCurrent, g);}, 1, 50);
+    }
+
+    const double nbGraphs = static_cast<double>(graphs.size());
+    std::printf("%7.0f %7.0f | %10.3f %10.3f %6.2fx | %10.3f %10.3f %6.2fx"
+                " | %s\n",
+                n / nbGraphs, nbEdges / nbGraphs,
+                fcapLegacy / nbGraphs, fcapCurrent / nbGraphs,
+                fcapLegacy / fcapCurrent,
+                ghLegacy / nbGraphs, ghCurrent / nbGraphs,
+                ghLegacy / ghCurrent,
+                same ? "same cuts" : "DIFFERENT CUTS");
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char** argv)
+{
+    const std::string arg = argc > 1 ? argv[1] : "800";
+    const double visited = argc > 2 ? std::atof(argv[2]) : 0.2;
+
+    /* one line per size (random graphs) or per recorded graph */
+    std::vector<std::vector<bench::SupportGraph>> rows;
+    const int maxN = std::atoi(arg.c_str());
+    if (maxN > 0)
+    {
+        for (int n = 50; n <= maxN; n *= 2)
+        {
+            std::mt19937 rng(n);
+            rows.emplace_back();
+            for (int g = 0; g < cNbGraphs; ++g)
+            {
+                rows.back().push_back(
+                    bench::randomSupportGraph(n, visited, rng));
+            }
+        }
+    }
+    else
+    {
+        for (auto& g : bench::readSupportGraphs(arg))
+        {
+            rows.push_back({std::move(g)});
+        }
+        if (rows.empty())
+        {
+            std::printf("no support graph read from %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    std::printf("%7s %7s | %-29s | %-29s |\n", "", "",
+                "FCAPFIX sequence (ms)", "GH cut tree (ms)");
+    std::printf("%7s %7s | %10s %10s %7s | %10s %10s %7s |\n", "n", "edges",
+                "legacy", "current", "", "legacy", "current", "");
+    for (const auto& graphs : rows)
+    {
+        benchGraphs(graphs);
+    }
+
+    return 0;
+}
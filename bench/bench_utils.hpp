@@ -0,0 +1,180 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: bench_utils.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Random or recorded (vehicle, period) support graphs and a timer for
+ * the separation benchmarks.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 11:05 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef BENCH_UTILS_HPP
+#define BENCH_UTILS_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace bench
+{
+
+/**
+ * @brief Support graph with the CVRPSEP node numbering (customers 1..n,
+ * depot n + 1) in 0-based arrays: demand[c - 1] is the demand of customer c
+ * and the edges are 0..nbEdges-1.
+*/
+struct SupportGraph
+{
+    int n = 0;
+    int cap = 0;
+    std::vector<int> demand;
+    std::vector<int> tail;
+    std::vector<int> head;
+    std::vector<double> x;
+
+    int nbEdges() const {return static_cast<int>(tail.size());}
+};
+
+/**
+ * @brief Fractional solution of an LP relaxation: the sum of three random
+ * giant tours with weights 1/2, 1/4 and 1/4, split into routes of 1 to 8
+ * customers (regardless of the capacity, so some capacity cuts are
+ * violated). The support graph has O(n) edges, as in the IRP separation.
+ * @param: number of customers.
+ * @param: fraction of the customers visited (in the IRP most customers are
+ * not served by a given vehicle in a given period: demand 0, no edges).
+ * @param: random number generator.
+ * @return: support graph.
+*/
+inline SupportGraph randomSupportGraph(const int n,
+                                       const double visited,
+                                       std::mt19937& rng)
+{
+    SupportGraph g;
+    g.n = n;
+    g.demand.assign(n, 0);
+    g.cap = 30 + static_cast<int>(rng() % 40);
+
+    const int depot = n + 1;
+    std::map<std::pair<int, int>, double> x;
+    auto addEdge = [&](const int i, const int j, const double w)
+    {
+        x[{std::min(i, j), std::max(i, j)}] += w;
+    };
+
+    std::vector<int> perm(n);
+    std::iota(perm.begin(), perm.end(), 1);
+    std::shuffle(perm.begin(), perm.end(), rng);
+    perm.resize(std::max(1, static_cast<int>(visited * n)));
+    for (const int i : perm)
+    {
+        g.demand[i - 1] = 1 + static_cast<int>(rng() % 20);
+    }
+
+    const double weight[] = {0.5, 0.25, 0.25};
+    for (const double w : weight)
+    {
+        std::shuffle(perm.begin(), perm.end(), rng);
+
+        int prev = depot, left = 1 + static_cast<int>(rng() % 8);
+        for (const int i : perm)
+        {
+            addEdge(prev, i, w);
+            prev = i;
+            if (--left == 0)
+            {
+                addEdge(prev, depot, w);
+                prev = depot;
+                left = 1 + static_cast<int>(rng() % 8);
+            }
+        }
+        if (prev != depot)
+        {
+            addEdge(prev, depot, w);
+        }
+    }
+
+    for (const auto& e : x)
+    {
+        g.tail.push_back(e.first.first);
+        g.head.push_back(e.first.second);
+        g.x.push_back(std::min(e.second, 2.0));
+    }
+
+    return g;
+}
+
+/**
+ * @brief Reads recorded support graphs. Text file, one graph after the
+ * other: "n cap nbEdges", the demands of the customers 1..n and nbEdges lines
+ * "tail head x" (depot n + 1).
+ * @param: file name.
+ * @return: support graphs (empty if the file cannot be read).
+*/
+inline std::vector<SupportGraph> readSupportGraphs(const std::string& path)
+{
+    std::vector<SupportGraph> graphs;
+    std::ifstream f(path);
+
+    SupportGraph g;
+    int nbEdges = 0;
+    while (f >> g.n >> g.cap >> nbEdges)
+    {
+        g.demand.assign(g.n, 0);
+        for (int i = 0; i < g.n; ++i)
+        {
+            f >> g.demand[i];
+        }
+
+        g.tail.assign(nbEdges, 0);
+        g.head.assign(nbEdges, 0);
+        g.x.assign(nbEdges, 0);
+        for (int e = 0; e < nbEdges; ++e)
+        {
+            f >> g.tail[e] >> g.head[e] >> g.x[e];
+        }
+
+        if (!f) break;
+        graphs.push_back(g);
+    }
+
+    return graphs;
+}
+
+/**
+ * @brief Mean wall time (ms) of f() over at least minReps calls and
+ * minMs milliseconds.
+*/
+template<typename F>
+double meanTimeMs(F f, const int minReps = 3, const double minMs = 200)
+{
+    using clock = std::chrono::steady_clock;
+    int reps = 0;
+    const auto t0 = clock::now();
+    double elapsed = 0;
+    do
+    {
+        f();
+        ++reps;
+        elapsed = std::chrono::duration<double, std::milli>(
+            clock::now() - t0).count();
+    } while (reps < minReps || elapsed < minMs);
+
+    return elapsed / reps;
+}
+
+} // namespace bench
+
+#endif // BENCH_UTILS_HPP
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: mxf_legacy.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief The CVRPSEP max flow package as it was before the forward star
+ * rewrite (same interface as mxf.h, namespace legacy), for bench_mxf.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 11:50 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef MXF_LEGACY_HPP
+#define MXF_LEGACY_HPP
+
+#include "../include/ext/cvrpsep/mxf.h"
+
+namespace legacy
+{
+
+void MXF_InitMem(MaxFlowPtr *Ptr,
+                 int TotalNodes,
+                 int TotalArcs);
+void MXF_FreeMem(MaxFlowPtr Ptr);
+void MXF_ClearNodeList(MaxFlowPtr Ptr);
+void MXF_ClearArcList(MaxFlowPtr Ptr);
+void MXF_SetNodeListSize(MaxFlowPtr Ptr,
+                         int TotalNodes);
+void MXF_AddArc(MaxFlowPtr Ptr,
+                int Tail,
+                int Head,
+                int Capacity);
+void MXF_ChgArcCap(MaxFlowPtr Ptr,
+                   int Tail,
+                   int Head,
+                   int Capacity);
+void MXF_CreateMates(MaxFlowPtr Ptr);
+void MXF_CreateArcMap(MaxFlowPtr Ptr);
+void MXF_SolveMaxFlow(MaxFlowPtr Ptr,
+                      char InitByZeroFlow,
+                      int Source,
+                      int Sink,
+                      int *CutValue,
+                      char GetSinkSide,
+                      int *NodeListSize,
+                      int *NodeList);
+void MXF_GetNetworkSize(MaxFlowPtr Ptr,
+                        int *Nodes,
+                        int *Arcs);
+void MXF_GetCurrentFlow(MaxFlowPtr Ptr,
+                        int *ArcResidualCapacity,
+                        int *NodeExcess);
+void MXF_SetFlow(MaxFlowPtr Ptr,
+                 int *ArcResidualCapacity,
+                 int *NodeExcess);
+void MXF_ComputeGHCutTree(MaxFlowPtr Ptr,
+                          int CenterNode,
+                          int *CutValue,
+                          int *NextOnPath);
+
+} // namespace legacy
+
+#endif // MXF_LEGACY_HPP
@@ -17,11 +17,20 @@
 #ifndef CALLBACK_SEC_HPP
 #define CALLBACK_SEC_HPP
 
+#include <map>
 #include <memory>
 
 #include "gurobi_c++.h"
 
 #include "../instance.hpp"
+#include "../valid_inequalities.hpp"
+#include "../var_index.hpp"
+#include "../utils/thread_pool.hpp"
+#include "capacity_separator.hpp"
+#include "cut_pool.hpp"
+#include "sep_scheduler.hpp"
+#include "sep_stats.hpp"
+#include "support_graph.hpp"
 
 class CallbackSEC : public GRBCallback
 {
@@ -29,61 +38,243 @@ public:
 
     enum class constrsType {lazy, cut};
 
-    CallbackSEC(const CallbackSEC& other) = default;
     CallbackSEC(CallbackSEC&& other) = default;
     ~CallbackSEC() = default;
 
     CallbackSEC() = delete;
+    CallbackSEC(const CallbackSEC& other) = delete;
     CallbackSEC& operator=(const CallbackSEC& other) = delete;
     CallbackSEC& operator=(CallbackSEC&& other) = delete;
 
-    CallbackSEC(
-        const std::vector<std::vector<std::vector<GRBVar>>>& q,
-        const std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
-        const std::vector<std::vector<std::vector<GRBVar>>>& y,
-        const std::shared_ptr<const Instance>& pInst);
+    /**
+     * @brief.
+     * @param: q, y and x variables stored contiguously (filled when the model
+     * is built, after the callback construction).
+     * @param: positions of the variables in the previous parameter.
+     * @param: instance.
+    */
+    CallbackSEC(const std::vector<GRBVar>& vars,
+                const VarIndex& idx,
+                const std::shared_ptr<const Instance>& pInst);
+
+    /**
+     * @brief Sets the number of threads used to separate the (k, t) support
+     * graphs of a callback call. With one thread (or zero) they are separated
+     * sequentially by the callback thread.
+     * @param: number of threads.
+    */
+    void setNbSepThreads(const std::size_t nbThreads);
+
+    /**
+     * @brief Selects the MIPNODE separation mode: one support graph per
+     * (k, t) (default) or one per period, aggregated over the (identical)
+     * vehicles, whose cuts are summed over k.
+     * @param: aggregated separation.
+    */
+    void setAggregatedSep(const bool aggregated);
+
+    /**
+     * @brief Enables the propagation of the customer sets found by the
+     * separation of one support graph to the other (vehicle, period) pairs.
+     * @param: propagation on/off.
+    */
+    void setSepPropagation(const bool propagate);
+
+    /**
+     * @brief Sets the policy deciding which MIPNODE calls are separated (see
+     * SepScheduler). By default every call is separated.
+     * @param: node frequency after the root (0: root only).
+     * @param: minimum violation to keep separating the same node.
+     * @param: minimum relative bound gain between separated nodes (0: no back
+     * off).
+    */
+    void setSepScheduler(const std::size_t nodeFreq,
+                         const double minViolation,
+                         const double backoffGain);
+
+    /**
+     * @brief Enables the exact (Gomory-Hu) separation at the first MIPNODE
+     * nodes. At those nodes it replaces the CVRPSEP separation.
+     * @param: the exact separation runs while the node count is smaller than
+     * this value (0: never; 1: root only).
+    */
+    void setExactSep(const std::size_t nbNodes);
+
+    /**
+     * @brief Selects the cut families of the MIPNODE separation.
+     * @param: CVRPSEP capacity sets translated into subtour elimination cuts.
+     * @param: multistar cuts (see addMultistarCuts()).
+     * @param: capacity cuts on the delivered quantities (see
+     * addQCapacityCuts()).
+    */
+    void setCutFamilies(const bool capSep,
+                        const bool mstarSep,
+                        const bool qcapSep);
+
+    /**
+     * @brief Separates a family of IRP valid inequalities as user cuts at
+     * the separated MIPNODE calls.
+     * @param: family.
+    */
+    void addValidIneqFamily(const ValidInequalities::family f);
+
+    /**
+     * @brief Prints the separation statistics (cut pool size and hit rate,
+     * time spent retrieving the solution values).
+    */
+    void showStats() const;
+
+    /**
+     * @brief Writes the separation statistics (calls, time, cuts found/added
+     * per (k, t) and maximum violation) in a JSON file.
+     * @param: file path.
+    */
+    void writeStatsJSON(const std::string& path) const;
 
 private:
 
-    // quantities delivered to i by vehicle k at time t
-    const std::vector<std::vector<std::vector<GRBVar>>>& m_q;
-    // equal to one if j immediately follows i in the route traveled at time t
-    const std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& m_x;
-    // retailer i is served at time t
-    const std::vector<std::vector<std::vector<GRBVar>>>& m_y;
+    /* customer sets (sorted, CVRPSEP numbering) found in a separation round
+       and the support graphs that found them */
+    using foundSets = std::map<std::vector<int>, std::vector<char>>;
+
+    /* quantities delivered (q), visitation (y) and routing (x) variables
+       stored contiguously */
+    const std::vector<GRBVar>& mVars;
+    // positions of q, y and x in mVars/mVals
+    const VarIndex mIdx;
 
     std::shared_ptr<const Instance> mpInst;
 
+    // values of mVars at the current callback call, reused across calls
+    std::vector<double> mVals;
+    // support graphs of mVals, rebuilt (in place) at each separation
+    SupportGraph mSupport;
+    // the same, one per period summed over the vehicles (aggregated mode)
+    SupportGraph mAggSupport;
+    // separation mode of the MIPNODE calls
+    bool mAggregatedSep;
+    // propagation of the sets found to the other support graphs
+    bool mPropagateSep;
+    // exact separation while the node count is smaller than it
+    std::size_t mExactSepNodes;
+    // cut families of the MIPNODE separation
+    bool mCapSep;
+    bool mMstarSep;
+    bool mQCapSep;
+    // IRP valid inequalities separated as user cuts
+    ValidInequalities mValidIneqs;
+
+    // separation statistics
+    SepStats mStats;
+    // which MIPNODE calls are separated
+    SepScheduler mScheduler;
+
+    // # of solution retrievals and time spent on them (in seconds)
+    std::size_t mNbRetrievals;
+    double mRetrievalTime;
+
+    // CVRPSEP cuts found so far for each (k, t), kept across invocations
+    CutPool mCutPool;
+    // the same for the aggregated graph of each period (as vehicle 0)
+    CutPool mAggCutPool;
+    // CVRPSEP capacity separation of each (k, t), index k * T + t
+    std::vector<CapacitySeparator> mCapSeparators;
+    // the same for the aggregated graph of each period
+    std::vector<CapacitySeparator> mAggCapSeparators;
+
+    // workers for the parallel separation (null: sequential separation)
+    std::unique_ptr<utils::ThreadPool> mpSepPool;
+
     void callback() override;
 
-    int addCVRPSEPCAP(const constrsType cstType);
+    /**
+     * @brief CVRPSEP capacity cuts separation of every (k, t) support graph,
+     * translated into subtour elimination lazy/cuts.
+     * @param: constraint type.
+     * @param: (output) maximum violation reported by the CVRPSEP.
+     * @return: number of lazy/cuts added.
+    */
+    int addCVRPSEPCAP(const constrsType cstType, double& maxViolation);
+
+    /**
+     * @brief CVRPSEP capacity cuts separation of the support graph of each
+     * period aggregated over the vehicles (K vehicles of capacity C_k). Each
+     * set S found gives sum_k x_k(E(S)) <= sum_k (y_k(S) - y_km), m in S.
+     * @param: constraint type.
+     * @param: (output) maximum violation reported by the CVRPSEP.
+     * @return: number of lazy/cuts added.
+    */
+    int addCVRPSEPCAPAggregated(const constrsType cstType,
+                                double& maxViolation);
+
+    /**
+     * @brief Exact subtour elimination separation of every (k, t) support
+     * graph: all the sets S given by the Gomory-Hu cut tree (rooted at the
+     * depot) with x(E(S)) > y(S) - y_m for some m in S.
+     * @param: constraint type.
+     * @param: (output) maximum violation of the lazy/cuts added.
+     * @return: number of lazy/cuts added.
+    */
+    int addExactSEC(const constrsType cstType, double& maxViolation);
+
+    /**
+     * @brief Multistar separation of every (k, t) support graph (greedy
+     * search of the customer sets), with the delivered quantities in place of
+     * the demands: q(S) + sum_P (q_j + B_j x_ij) - (C_k / 2) x(delta(S)) <=
+     * sum_P B_j, P being pairs i in S, j not in S and B_j = min(C_k, U_j).
+     * Separates mVals, which must hold the values of the current call.
+     * @param: constraint type.
+     * @param: (output) maximum violation of the lazy/cuts added.
+     * @return: number of lazy/cuts added.
+    */
+    int addMultistarCuts(const constrsType cstType, double& maxViolation);
 
     /**
-     * @brief Retrieve the q variables values from the relaxation solution at
-     * the current node.
+     * @brief Capacity separation of every (k, t) support graph on the real
+     * valued delivered quantities (one max flow per graph): the most violated
+     * x(E(S)) <= y(S) - q(S) / C_k. Separates mVals, which must hold the
+     * values of the current call.
      * @param: constraint type.
-     * @return: q variables values at the current node.
+     * @param: (output) maximum violation of the lazy/cuts added.
+     * @return: number of lazy/cuts added.
+    */
+    int addQCapacityCuts(const constrsType cstType, double& maxViolation);
+
+    /**
+     * @brief Adds the IRP valid inequalities (mValidIneqs) violated by mVals,
+     * which must hold the values of the current call, as user cuts.
+     * @return: number of cuts added.
     */
-    std::vector<std::vector<std::vector<double>>> getqVarsValues(
-        const constrsType cstType);
+    int addValidIneqCuts();
 
     /**
-     * @brief Retrieve the x variables values from the relaxation solution at
-     * the current node.
+     * @brief Checks the sets found in a separation round against the support
+     * graphs that did not find them and adds the violated subtour
+     * elimination lazy/cuts (summed over the vehicles if aggregated). The
+     * support graphs must be the ones of the current round.
      * @param: constraint type.
-     * @return: x variables values at the current node.
+     * @param: sets found and where.
+     * @param: aggregated (one graph per period) or per (k, t) graphs.
+     * @return: number of lazy/cuts added.
+    */
+    int propagateCuts(const constrsType cstType,
+                      const foundSets& sets,
+                      const bool aggregated);
+
+    /**
+     * @brief Exact separation for integer solutions (MIPSOL): the components
+     * of each (k, t) support graph not connected to the depot are found with
+     * union-find and cut off by lazy subtour elimination constraints.
+     * @return: number of lazy constraints added.
     */
-    std::vector<std::vector<std::vector<std::vector<double>>>> getxVarsValues(
-        const constrsType cstType);
+    int addIntegerSEC();
 
     /**
-     * @brief Retrieve the y variables values from the relaxation solution at
-     * the current node.
+     * @brief Retrieves the values of all variables in mVars at once
+     * (MIPSOL solution or MIPNODE relaxation) into mVals.
      * @param: constraint type.
-     * @return: y variables values at the current node.
     */
-    std::vector<std::vector<std::vector<double>>> getyVarsValues(
-        const constrsType cstType);
+    void getVarsValues(const constrsType cstType);
 };
 
 #endif // CALLBACK_SEC_HPP
\ No newline at end of file
@@ -0,0 +1,163 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: capacity_separator.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief CVRPSEP capacity cuts separation (CAPSEP_SeparateCapCuts) of one
+ * support graph, class declaration. It owns the CVRPSEP output between calls
+ * and returns the cuts in a flat batch; it does not depend on Gurobi.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 18, 2026, 01:40 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CAPACITY_SEPARATOR_HPP
+#define CAPACITY_SEPARATOR_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "../ext/cvrpsep/cnstrmgr.h"
+#include "../utils/span.hpp"
+
+class CapacitySeparator
+{
+public:
+
+    /**
+     * @brief Customer sets of the capacity cuts of one separation: cut c has
+     * its size at position offset(c) of a flat array of node ids, followed by
+     * its nodes (sorted, CVRPSEP numbering).
+    */
+    class CutBatch
+    {
+    public:
+
+        /**
+         * @brief Number of cuts.
+        */
+        std::size_t size() const;
+
+        /**
+         * @brief Nodes of cut c.
+        */
+        utils::Span<const int> getNodes(const std::size_t c) const;
+
+        /**
+         * @brief Nodes of cut c as a CVRPSEP list (IntList[1..size], position
+         * 0 holds the size), e.g., for CMGR_AddCnstr().
+        */
+        const int* getIntList(const std::size_t c) const;
+
+        /**
+         * @brief Right-hand side of cut c: x(E(S)) <= |S| - k(S).
+        */
+        double getRHS(const std::size_t c) const;
+
+        /**
+         * @brief Removes the cuts (the memory is kept for the next batch).
+        */
+        void clear();
+
+        /**
+         * @brief Appends a cut.
+         * @param: set size.
+         * @param: set (CVRPSEP list: IntList[1..IntListSize]).
+         * @param: right-hand side.
+        */
+        void add(const int intListSize, const int* intList, const double rhs);
+
+    private:
+
+        // position of the size of each cut in mNodes
+        std::vector<std::size_t> mOffsets;
+        // size of cut 0, its nodes, size of cut 1, its nodes, ...
+        std::vector<int> mNodes;
+        std::vector<double> mRHS;
+    };
+
+    CapacitySeparator(CapacitySeparator&& other) = default;
+    ~CapacitySeparator() = default;
+
+    CapacitySeparator() = delete;
+    CapacitySeparator(const CapacitySeparator& other) = delete;
+    CapacitySeparator& operator=(const CapacitySeparator& other) = delete;
+    CapacitySeparator& operator=(CapacitySeparator&& other) = delete;
+
+    /**
+     * @brief.
+     * @param: maximum number of cuts of one separation.
+     * @param: tolerance of the integrality test of the solution.
+    */
+    CapacitySeparator(const int maxNbCuts, const double epsIntegrality);
+
+    /**
+     * @brief Separates the capacity cuts of a support graph. The spans are
+     * 0-based; the nodes keep the CVRPSEP numbering (customers 1..n, depot
+     * n + 1). They are copied into the 1-based arrays of CVRPSEP kept by the
+     * separator. The work buffers are drawn from the memory arena of the
+     * calling thread.
+     * @param: number of customers n.
+     * @param: vehicle capacity.
+     * @param: demands (demand[c - 1] is the demand of customer c).
+     * @param: edge tails.
+     * @param: edge heads.
+     * @param: edge values.
+     * @param: cuts found before, which are not returned again.
+     * @return: cuts found, valid until the next call.
+    */
+    const CutBatch& separate(const int nbCustomers,
+                             const int capacity,
+                             utils::Span<const int> demand,
+                             utils::Span<const int> edgeTail,
+                             utils::Span<const int> edgeHead,
+                             utils::Span<const double> edgeX,
+                             CnstrMgrPointer existingCuts);
+
+    /**
+     * @brief Cuts found by the last separation.
+    */
+    const CutBatch& getCuts() const;
+
+    /**
+     * @brief Maximum violation reported by the last separation.
+    */
+    double getMaxViolation() const;
+
+    /**
+     * @brief Whether the solution of the last separation was integer and
+     * feasible.
+    */
+    bool isIntegerAndFeasible() const;
+
+private:
+
+    struct cmgrDeleter
+    {
+        void operator()(CnstrMgrPointer p) const;
+    };
+
+    int mMaxNbCuts;
+    double mEpsIntegrality;
+
+    // CVRPSEP input (1-based, position 0 unused), reused across separations
+    std::vector<int> mDemand;
+    std::vector<int> mEdgeTail;
+    std::vector<int> mEdgeHead;
+    std::vector<double> mEdgeX;
+
+    // CVRPSEP output, emptied (not freed) at each separation
+    std::unique_ptr<CnstrMgrRecord, cmgrDeleter> mpCutsCMP;
+    // capacity cuts of the last separation
+    CutBatch mCuts;
+
+    double mMaxViolation;
+    bool mIntegerAndFeasible;
+};
+
+#endif // CAPACITY_SEPARATOR_HPP
@@ -0,0 +1,108 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: cut_pool.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Long-lived pool of CVRPSEP capacity cuts, one constraint manager per
+ * (vehicle, period) pair, class declaration.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 09:10 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CUT_POOL_HPP
+#define CUT_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "../ext/cvrpsep/cnstrmgr.h"
+
+class CutPool
+{
+public:
+
+    CutPool(CutPool&& other) = default;
+    ~CutPool() = default;
+
+    CutPool() = delete;
+    CutPool(const CutPool& other) = delete;
+    CutPool& operator=(const CutPool& other) = delete;
+    CutPool& operator=(CutPool&& other) = delete;
+
+    /**
+     * @brief Creates one empty constraint manager for each (k, t) pair.
+     * @param: number of vehicles.
+     * @param: number of periods.
+    */
+    CutPool(const int K, const int T);
+
+    /**
+     * @brief Inserts a capacity cut (1-based sorted node list, CVRPSEP
+     * numbering) in the pool of (k, t) if it is not already there.
+     * @param: vehicle.
+     * @param: period.
+     * @param: node list size.
+     * @param: node list (IntList[1..IntListSize]).
+     * @param: right-hand side.
+     * @return: true if the cut was new; false if it was a pool hit.
+    */
+    bool addCap(const int k,
+                const int t,
+                const int intListSize,
+                const int* intList,
+                const double rhs);
+
+    /**
+     * @brief Constraint manager holding the cuts already found for (k, t). It
+     * is meant to be passed as CMPExistingCuts to CAPSEP_SeparateCapCuts.
+    */
+    CnstrMgrPointer getCMP(const int k, const int t) const;
+
+    /**
+     * @brief Number of (not necessarily distinct) cuts offered to the pool.
+    */
+    std::size_t getNbLookups() const;
+
+    /**
+     * @brief Number of offered cuts that were already in the pool.
+    */
+    std::size_t getNbHits() const;
+
+    /**
+     * @brief Number of distinct cuts stored over all (k, t) pairs.
+    */
+    std::size_t getSize() const;
+
+    /**
+     * @brief Prints the pool size and hit rate.
+    */
+    void show() const;
+
+private:
+
+    struct cmgrDeleter
+    {
+        void operator()(CnstrMgrPointer p) const;
+    };
+
+    struct entry
+    {
+        std::unique_ptr<CnstrMgrRecord, cmgrDeleter> cmp;
+        std::size_t nbLookups;
+        std::size_t nbHits;
+    };
+
+    // number of periods (row stride of mEntries)
+    int mT;
+
+    // one constraint manager (and its counters) per (k, t), index k * T + t
+    std::vector<entry> mEntries;
+};
+
+#endif // CUT_POOL_HPP
@@ -0,0 +1,82 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: sep_scheduler.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Policy deciding at which MIPNODE callback calls the fractional
+ * separation runs, class declaration.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 04:50 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SEP_SCHEDULER_HPP
+#define SEP_SCHEDULER_HPP
+
+#include <cstddef>
+
+class SepScheduler
+{
+public:
+
+    SepScheduler(const SepScheduler& other) = default;
+    SepScheduler(SepScheduler&& other) = default;
+    ~SepScheduler() = default;
+    SepScheduler& operator=(const SepScheduler& other) = default;
+    SepScheduler& operator=(SepScheduler&& other) = default;
+
+    SepScheduler() = delete;
+
+    /**
+     * @brief The root node is always separated (every cut round). After the
+     * root a node is separated every nodeFreq nodes and, inside a separated
+     * node, the rounds go on while the last round violation is at least
+     * minViolation. If the best bound improves (relatively) less than
+     * backoffGain between two separated nodes, nodeFreq is doubled, and it is
+     * reset when the bound moves again.
+     * @param: node frequency (0: separate only the root; 1: every node).
+     * @param: minimum violation to keep separating the same node (0: always).
+     * @param: minimum relative bound gain (0: no back off).
+    */
+    SepScheduler(const std::size_t nodeFreq,
+                 const double minViolation,
+                 const double backoffGain);
+
+    /**
+     * @brief True if the current MIPNODE call should be separated.
+     * @param: node count (GRB_CB_MIPNODE_NODCNT).
+     * @param: best objective bound (GRB_CB_MIPNODE_OBJBND).
+    */
+    bool isDue(const double nodeCount, const double objBound);
+
+    /**
+     * @brief Records the outcome of a separation round.
+     * @param: maximum violation found in the round.
+    */
+    void record(const double maxViolation);
+
+    /**
+     * @brief Current node frequency (after the back off).
+    */
+    std::size_t getNodeFreq() const;
+
+private:
+
+    std::size_t mNodeFreq;
+    double mMinViolation;
+    double mBackoffGain;
+
+    // node frequency after the back off
+    std::size_t mCurFreq;
+
+    // last separated node, its bound and the last round violation
+    double mLastNode;
+    double mLastBound;
+    double mLastViolation;
+};
+
+#endif // SEP_SCHEDULER_HPP
@@ -0,0 +1,161 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: sep_stats.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Statistics of the callback separation (calls, time, cuts and
+ * violations), class declaration.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 04:05 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SEP_STATS_HPP
+#define SEP_STATS_HPP
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+class SepStats
+{
+public:
+
+    SepStats(const SepStats& other) = default;
+    SepStats(SepStats&& other) = default;
+    ~SepStats() = default;
+
+    SepStats() = delete;
+    SepStats& operator=(const SepStats& other) = delete;
+    SepStats& operator=(SepStats&& other) = delete;
+
+    /**
+     * @brief.
+     * @param: number of vehicles.
+     * @param: number of periods.
+    */
+    SepStats(const int K, const int T);
+
+    /**
+     * @brief Counts one callback call.
+     * @param: callback where (GRB_CB_*).
+    */
+    void addCall(const int where);
+
+    /**
+     * @brief Counts one MIPNODE call not separated by the scheduler.
+    */
+    void addSkipped();
+
+    /**
+     * @brief Adds the time of one separation.
+     * @param: callback where (GRB_CB_*).
+     * @param: time (in seconds).
+    */
+    void addSepTime(const int where, const double time);
+
+    /**
+     * @brief Counts the cuts of one (k, t) support graph separation. The per
+     * (k, t) counts and the cut totals (show() and writeJSON()) are made of
+     * these cuts only.
+     * @param: vehicle.
+     * @param: period.
+     * @param: number of cuts found by the separation routine.
+     * @param: number of lazy/cuts actually added to the model.
+    */
+    void addCuts(const int k,
+                 const int t,
+                 const std::size_t nbFound,
+                 const std::size_t nbAdded);
+
+    /**
+     * @brief Counts lazy/cuts added by the propagation of sets found in other
+     * support graphs (they are also counted by addCuts()).
+    */
+    void addPropagated(const std::size_t nbAdded);
+
+    /**
+     * @brief Counts lazy/cuts added by the exact (Gomory-Hu) separation (they
+     * are also counted by addCuts()).
+    */
+    void addExact(const std::size_t nbAdded);
+
+    /**
+     * @brief Counts the cuts of one family. The cuts of a support graph
+     * family are also counted per (k, t) by addCuts(); a family whose cuts
+     * are not tied to one (k, t) is only counted here.
+     * @param: family name.
+     * @param: number of cuts found by the separation routine.
+     * @param: number of lazy/cuts actually added to the model.
+    */
+    void addFamily(const std::string& family,
+                   const std::size_t nbFound,
+                   const std::size_t nbAdded);
+
+    /**
+     * @brief Keeps the maximum violation reported by the separation.
+    */
+    void addViolation(const double violation);
+
+    /**
+     * @brief True if more than period seconds passed since the last time it
+     * returned true (or since the construction).
+     * @param: period (in seconds).
+    */
+    bool isLogDue(const double period);
+
+    /**
+     * @brief Prints a one line summary.
+    */
+    void show() const;
+
+    /**
+     * @brief Writes all statistics, including the per (k, t) counts, in a
+     * JSON file.
+     * @param: file path.
+    */
+    void writeJSON(const std::string& path) const;
+
+private:
+
+    struct counts
+    {
+        std::size_t nbFound = 0;
+        std::size_t nbAdded = 0;
+    };
+
+    int mT;
+
+    // # of callback calls and separation time (in seconds) per where
+    std::map<int, std::size_t> mNbCalls;
+    std::map<int, double> mSepTime;
+    // # of MIPNODE calls skipped by the scheduler
+    std::size_t mNbSkipped;
+
+    // cuts found/added per (k, t), index k * T + t (support graph cuts)
+    std::vector<counts> mCuts;
+    // # of them added by the propagation
+    std::size_t mNbPropagated;
+    // # of them added by the exact separation
+    std::size_t mNbExact;
+    // cuts found/added per family
+    std::map<std::string, counts> mFamilies;
+
+    double mMaxViolation;
+
+    std::chrono::steady_clock::time_point mLastLog;
+
+    std::size_t getNbCalls(const int where) const;
+
+    double getSepTime(const int where) const;
+
+    counts getTotalCuts() const;
+};
+
+#endif // SEP_STATS_HPP
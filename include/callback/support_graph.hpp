@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: support_graph.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Sparse support graphs of the (vehicle, period) pairs in the CVRPSEP
+ * format, class declaration.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 02:30 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef SUPPORT_GRAPH_HPP
+#define SUPPORT_GRAPH_HPP
+
+#include <vector>
+
+#include "../var_index.hpp"
+
+class SupportGraph
+{
+public:
+
+    SupportGraph(const SupportGraph& other) = default;
+    SupportGraph(SupportGraph&& other) = default;
+    ~SupportGraph() = default;
+
+    SupportGraph() = delete;
+    SupportGraph& operator=(const SupportGraph& other) = delete;
+    SupportGraph& operator=(SupportGraph&& other) = delete;
+
+    /**
+     * @brief Allocates the edge lists and demands of every (k, t) pair or, if
+     * aggregated, of every period (x and q summed over the vehicles; the
+     * graphs are then accessed with k = 0).
+     * @param: positions of the q, y and x variables in the value vectors.
+     * @param: number of vertices (depot and customers).
+     * @param: number of vehicles.
+     * @param: number of periods.
+     * @param: one graph per period (aggregated over the vehicles).
+    */
+    SupportGraph(const VarIndex& idx,
+                 const int nbVertices,
+                 const int K,
+                 const int T,
+                 const bool aggregated);
+
+    /**
+     * @brief Rebuilds the support graphs from a solution: edges with x greater
+     * than eps and rounded up delivered quantities. By the degree rows,
+     * x_ijkt > 0 implies y_ikt > 0 and y_jkt > 0, so only the pairs of
+     * vertices with a positive y are read: O(n + m^2) per (k, t), m being the
+     * number of such vertices. The edge lists keep their capacity from one
+     * call to the next.
+     * @param: q, y and x values (VarIndex order).
+     * @param: tolerance.
+    */
+    void build(const std::vector<double>& vals, const double eps);
+
+    /**
+     * @brief Number of edges in the support graph of (k, t).
+    */
+    int getNbEdges(const int k, const int t) const;
+
+    /**
+     * @brief Edge tails, heads and values of (k, t), edges 0..nbEdges-1, with
+     * the CVRPSEP node numbering: customers 1..n-1 and depot n.
+    */
+    int* getEdgeTail(const int k, const int t);
+
+    int* getEdgeHead(const int k, const int t);
+
+    double* getEdgeX(const int k, const int t);
+
+    /**
+     * @brief Demands (rounded up delivered quantities) of (k, t), indexed by
+     * vertex (the depot 0 has none).
+    */
+    int* getDemand(const int k, const int t);
+
+private:
+
+    struct graph
+    {
+        std::vector<int> edgeTail;
+        std::vector<int> edgeHead;
+        std::vector<double> edgeX;
+        std::vector<int> demand;
+    };
+
+    VarIndex mIdx;
+    int mN;
+    int mK;
+    int mT;
+    bool mAggregated;
+
+    // vertices with a positive y in the (k, t) (or period) being built
+    std::vector<int> mVisited;
+
+    // one graph per (k, t), index k * T + t (per t if aggregated)
+    std::vector<graph> mGraphs;
+
+    int getGraphIdx(const int k, const int t) const;
+
+    void buildAggregated(const std::vector<double>& vals, const double eps);
+};
+
+#endif // SUPPORT_GRAPH_HPP
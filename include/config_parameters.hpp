@@ -32,6 +32,16 @@ public:
         bool show_log;          // print output parameters
         std::size_t time_limit;  // time limit of the solver
         std::size_t nb_threads; // # of threads used by solver
+        std::size_t sep_nb_threads; // # of threads used by CVRPSEP separation
+        bool sep_aggregated;        // one support graph per period
+        bool sep_propagate;         // propagate the sets to the other graphs
+        std::size_t sep_node_freq;  // separate every N nodes after the root
+        double sep_min_violation;   // keep separating a node above it
+        double sep_backoff_gain;    // back off below this bound gain
+        std::size_t sep_exact_nodes; // exact separation in the first N nodes
+        bool sep_cap;               // CVRPSEP capacity sets (as SECs)
+        bool sep_mstar;             // multistar cuts
+        bool sep_qcap;              // capacity cuts on the real valued q
         std::string logFile_;
     };
 
@@ -39,10 +49,16 @@ public:
     {
         enum policy_opt {ML, OU};
         enum sec_opt {STD, CVRPSEP};
+        enum vi_opt {OFF, STATIC, CUT};
 
         int K_;
         policy_opt policy;
         sec_opt sec_strategy;
+        vi_opt vi_depot_edge;   // x_0i <= 2 y_i
+        vi_opt vi_depot_visit;  // y_i <= y_0
+        vi_opt vi_min_visits;   // minimum number of visits over time windows
+        vi_opt vi_inventory;    // stock covering a window without visits
+        bool names;             // name the constraints when building
     };
 
     /**
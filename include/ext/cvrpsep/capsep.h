@@ -12,6 +12,9 @@ void CAPSEP_GetOneVehicleCapCuts(CnstrMgrPointer CutsCMP,
                                  ReachPtr *RPtr,
                                  int *NoOfCuts);
 
+/* The separation keeps no global state: it may run concurrently on several
+   threads as long as each call has its own CutsCMP and no other thread
+   modifies CMPExistingCuts meanwhile. */
 void CAPSEP_SeparateCapCuts(int NoOfCustomers,
                             int *Demand,
                             int CAP,
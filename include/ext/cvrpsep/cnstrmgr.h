@@ -56,10 +56,23 @@ typedef struct
   CnstrPointerList CPL;
   int Dim; /* Vector is zero-based (0..Dim-1). */
   int Size;
+  /* Hash index of the capacity constraints, by the hash of their IntList
+     (see CMGR_SearchCap). CPL[0..HashedSize-1] are in the index: bucket b
+     starts at CPL[HashFirst[b]-1] and continues at CPL[HashNext[i]-1]
+     (0 ends a bucket). HashSize is a power of 2. */
+  int HashSize;
+  int HashedSize;
+  int *HashFirst;
+  int *HashNext;
+  unsigned int *HashKey;
 } CnstrMgrRecord;
 typedef CnstrMgrRecord *CnstrMgrPointer;
 
 
+/* CMGR_AddCnstr() does not add a capacity constraint (CMGR_CT_CAP) whose
+   IntList is already in the manager; the other CMGR_Add* routines always
+   add. Code writing CPL directly (instead of CMGR_MoveCnstr(),
+   CMGR_ClearCnstr(), CMGR_CompressCMP()) must reset HashedSize to 0. */
 void CMGR_CreateCMgr(CnstrMgrPointer *CMP, int Dim);
 void CMGR_FreeMemCMgr(CnstrMgrPointer *CMP);
 void CMGR_AddCnstr(CnstrMgrPointer CMP,
@@ -5,11 +5,11 @@
 #ifndef _H_COMPCUTS
 #define _H_COMPCUTS
 
-void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
+void COMPCUTS_ComputeCompCuts(CSRGraphPtr SupportPtr,
                               int NoOfCustomers,
                               int *Demand,
                               int CAP,
-                              double **XMatrix,
+                              SparseMatrixPtr XMatrix,
                               CnstrMgrPointer CutsCMP,
                               int *GeneratedCuts);
 
@@ -5,13 +5,13 @@
 #ifndef _H_COMPRESS
 #define _H_COMPRESS
 
-void COMPRESS_ShrinkGraph(ReachPtr SupportPtr,
+void COMPRESS_ShrinkGraph(CSRGraphPtr SupportPtr,
                           int NoOfCustomers,
-                          double **XMatrix,
-                          double **SMatrix,
+                          SparseMatrixPtr XMatrix,
+                          SparseMatrixPtr SMatrix,
                           int NoOfV1Cuts,
                           ReachPtr V1CutsPtr,
-                          ReachPtr SAdjRPtr, /* Shrunk support graph */
+                          CSRGraphPtr *SAdjPtr, /* Shrunk support graph */
                           ReachPtr SuperNodesRPtr, /* Nodes in supernodes */
                           int *ShrunkGraphCustNodes); /* Excl. depot */
 
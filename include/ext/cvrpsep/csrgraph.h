@@ -0,0 +1,41 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: csrgraph.h
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Compressed sparse row (forward star) graph replacing the ReachPtr
+ * support graphs of the CAPSEP routines.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 18, 2026, 12:20 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _H_CSRGRAPH
+#define _H_CSRGRAPH
+
+typedef struct
+{
+  int n; /* Nodes 1..n */
+  int NoOfArcs;
+  int *FirstArc; /* Arcs of node i: FirstArc[i]..FirstArc[i+1]-1 */
+  int *ArcHead; /* Head of each arc 1..NoOfArcs */
+} CSRGraphRec;
+
+typedef CSRGraphRec *CSRGraphPtr;
+
+/* CSR_InitMem() leaves every list empty; the lists may then be written
+   directly, node by node in increasing order. CSR_CreateFromEdges() builds
+   the undirected graph of an edge list (arrays 1..NoOfEdges): the arcs of
+   node i are in the order of its edges, as with ReachAddForwArc().
+   Each graph is a single memory block. */
+void CSR_InitMem(CSRGraphPtr *P, int n, int MaxArcs);
+void CSR_CreateFromEdges(CSRGraphPtr *P, int n, int NoOfEdges,
+                         int *EdgeTail, int *EdgeHead);
+void CSR_FreeMem(CSRGraphPtr *P);
+void CSR_Write(CSRGraphPtr P);
+
+#endif
@@ -5,11 +5,11 @@
 #ifndef _H_CUTBASE
 #define _H_CUTBASE
 
-void CUTBASE_CompXSumInSet(ReachPtr SupportPtr,
+void CUTBASE_CompXSumInSet(CSRGraphPtr SupportPtr,
                            int NoOfCustomers,
                            char *InNodeSet,
                            int *NodeList, int NodeListSize,
-                           double **XMatrix,
+                           SparseMatrixPtr XMatrix,
                            double *XSumInSet);
 
 void CUTBASE_CompVehiclesForSet(int NoOfCustomers,
@@ -20,12 +20,12 @@ void CUTBASE_CompVehiclesForSet(int NoOfCustomers,
                                 int CAP,
                                 int *MinV);
 
-void CUTBASE_CompCapViolation(ReachPtr SupportPtr,
+void CUTBASE_CompCapViolation(CSRGraphPtr SupportPtr,
                               int NoOfCustomers,
                               char *NodeInSet,
                               int *NodeList, int NodeListSize,
                               int *Demand, int CAP,
-                              double **XMatrix,
+                              SparseMatrixPtr XMatrix,
                               double *Violation);
 
 #endif
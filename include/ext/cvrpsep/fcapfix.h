@@ -5,11 +5,11 @@
 #ifndef _H_FCAPFIX
 #define _H_FCAPFIX
 
-void FCAPFIX_ComputeCuts(ReachPtr SupportPtr,
+void FCAPFIX_ComputeCuts(CSRGraphPtr SupportPtr,
                          int NoOfCustomers,
                          int *Demand, int CAP,
                          int *SuperNodeSize,
-                         double **XMatrix,
+                         SparseMatrixPtr XMatrix,
                          int MaxCuts,
                          int MaxRounds,
                          int *NoOfGeneratedCuts,
@@ -25,12 +25,12 @@ void GRSEARCH_AddSet(ReachPtr RPtr,
                      int *List,
                      char AddFullSumList);
 
-void GRSEARCH_CapCuts(ReachPtr SupportPtr,
+void GRSEARCH_CapCuts(CSRGraphPtr SupportPtr,
                       int NoOfCustomers,
                       int *Demand, int CAP,
                       int *SuperNodeSize,
                       double *XInSuperNode,
-                      double **XMatrix,
+                      SparseMatrixPtr XMatrix,
                       int *GeneratedSets,
                       int *GeneratedAntiSets,
                       ReachPtr SetsRPtr, /* Identified cuts. */
@@ -45,14 +45,14 @@ void GRSEARCH_CheckForExistingSet(ReachPtr RPtr,
                                   int NodeSetSize,
                                   char *ListFound);
 
-void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
+void GRSEARCH_AddDropCapsOnGS(CSRGraphPtr SupportPtr, /* On GS */
                               int NoOfCustomers,
                               int ShrunkGraphCustNodes,
                               int *SuperDemand, int CAP,
                               int *SuperNodeSize,
                               double *XInSuperNode,
                               ReachPtr SuperNodesRPtr,
-                              double **SMatrix, /* Shrunk graph */
+                              SparseMatrixPtr SMatrix, /* Shrunk graph */
                               double Eps,
                               CnstrMgrPointer CMPSourceCutList,
                               int *NoOfGeneratedSets,
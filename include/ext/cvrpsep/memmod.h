@@ -20,4 +20,16 @@ double* MemGetDV(int n);
 double** MemGetDM(int Rows, int Cols);
 void MemFreeDM(double **p, int Rows);
 
+/* Per-thread arena. Between MemArenaBegin() and MemArenaEnd() the MemGet*
+   calls of a thread draw from its arena (MemFree is a no-op on them), and
+   MemArenaEnd() releases all of them at once. The arena keeps its memory for
+   the next separation of the thread. Memory that must outlive the separation
+   (constraint managers) is allocated between MemArenaSuspend() and
+   MemArenaResume(). */
+void MemArenaBegin(void);
+void MemArenaEnd(void);
+int MemArenaSuspend(void);
+void MemArenaResume(int Active);
+long MemArenaPeak(void);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: spmatrix.h
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Sparse symmetric matrix (compressed rows) replacing the dense
+ * (n+2)x(n+2) XMatrix/SMatrix of the CAPSEP routines.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 10:40 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef _H_SPMATRIX
+#define _H_SPMATRIX
+
+typedef struct
+{
+  int Dim; /* Rows (and columns) 1..Dim */
+  int MaxDim;
+  int MaxEntries; /* Memory is allocated for <MaxEntries> entries */
+  int NoOfEntries; /* Off-diagonal entries, (i,j) and (j,i) both counted */
+  int *RowStart; /* Row i: positions RowStart[i]..RowStart[i+1]-1 */
+  int *Col; /* Column of each entry, increasing within a row */
+  double *Val;
+  double *Diag; /* Diag[i] = entry (i,i) */
+  int *WrkRow, *WrkCol, *WrkPos, *WrkCount; /* (used by SPM_Finish) */
+  double *WrkVal;
+} SparseMatrixRec;
+
+typedef SparseMatrixRec *SparseMatrixPtr;
+
+/* Usage: SPM_Clear(), SPM_AddSym() for each edge (duplicates are summed in
+   the order they are added, as with += on a dense matrix), SPM_Finish().
+   Rows may be read directly (RowStart, Col, Val) or by SPM_Get(), which
+   returns 0.0 for absent entries. */
+void SPM_InitMem(SparseMatrixPtr *P, int MaxDim, int MaxEntries);
+void SPM_FreeMem(SparseMatrixPtr *P);
+void SPM_Clear(SparseMatrixPtr P, int Dim);
+void SPM_AddSym(SparseMatrixPtr P, int Row, int Col, double X);
+void SPM_Finish(SparseMatrixPtr P);
+double SPM_Get(SparseMatrixPtr P, int Row, int Col);
+
+#endif
@@ -6,11 +6,21 @@
 #define _H_STRNGCMP
 
 #include "basegrph.h"
+#include "csrgraph.h"
 
+/* Reentrant: all state is local to the call; the work vectors
+   (CVWrk1, IVWrk1..IVWrk4, dimension n+1) are supplied by the caller. */
 void ComputeStrongComponents(ReachPtr RPtr, ReachPtr ResultPtr,
                              int *NoOfComponents, int n,
                              char *CVWrk1,
                              int *IVWrk1, int *IVWrk2, int *IVWrk3,
                              int *IVWrk4);
 
+/* The same on a CSR graph (nodes 1..n). */
+void ComputeStrongComponentsCSR(CSRGraphPtr GPtr, ReachPtr ResultPtr,
+                                int *NoOfComponents, int n,
+                                char *CVWrk1,
+                                int *IVWrk1, int *IVWrk2, int *IVWrk3,
+                                int *IVWrk4);
+
 #endif
\ No newline at end of file
@@ -16,15 +16,135 @@
 #ifndef INIT_GRB_MODE_HPP
 #define INIT_GRB_MODE_HPP
 
+#include <chrono>
+#include <cstddef>
+#include <initializer_list>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "gurobi_c++.h"
 
 #include "instance.hpp"
+#include "var_index.hpp"
 
 namespace init
 {
 
+/**
+ * @brief Names of the constraints given on demand: only their keys (a prefix
+ * followed by ids, e.g., 9C_ and i, k, t for 9C_i_k_t) are kept while the
+ * model is built, and setNames() names them.
+*/
+class ConstrNames
+{
+public:
+
+    ConstrNames() = default;
+    ConstrNames(const ConstrNames& other) = default;
+    ConstrNames(ConstrNames&& other) = default;
+    ~ConstrNames() = default;
+    ConstrNames& operator=(const ConstrNames& other) = default;
+    ConstrNames& operator=(ConstrNames&& other) = default;
+
+    /**
+     * @brief Keeps the key of the next constraint (see addConstrs()).
+     * @param: prefix.
+     * @param: ids, separated by '_' in the name.
+    */
+    void addKey(const char* prefix, std::initializer_list<int> ids);
+
+    /**
+     * @brief Constraints of the keys kept since the last call, in the same
+     * order.
+     * @param: constraints.
+     * @param: number of constraints.
+    */
+    void addConstrs(const GRBConstr* pConstrs, const std::size_t nbConstrs);
+
+    /**
+     * @brief Names the constraints of the kept keys and frees the keys.
+     * @param: model.
+    */
+    void setNames(GRBModel& model);
+
+private:
+
+    std::vector<GRBConstr> mConstrs;
+    std::vector<std::string> mPrefixes;
+    // prefix (position in mPrefixes) and first id (in mIds) of each key
+    std::vector<int> mKeyPrefix;
+    std::vector<std::size_t> mKeyBegin;
+    std::vector<int> mIds;
+};
+
+/**
+ * @brief Constraints of a family, added to the model with a single
+ * addConstrs() call. Each row is built as sparse coefficient arrays
+ * (addTerm()) and written in an expression with addTerms() (endRow()). The
+ * rows are added unnamed; their name keys are kept in a ConstrNames.
+*/
+class ConstrBatch
+{
+public:
+
+    ConstrBatch(const ConstrBatch& other) = default;
+    ConstrBatch(ConstrBatch&& other) = default;
+    ~ConstrBatch() = default;
+
+    ConstrBatch() = delete;
+    ConstrBatch& operator=(const ConstrBatch& other) = delete;
+    ConstrBatch& operator=(ConstrBatch&& other) = delete;
+
+    /**
+     * @brief Empty batch; its build time starts now.
+     * @param: family name (log).
+     * @param: (output) name keys of the rows.
+     * @param: expected number of rows.
+    */
+    ConstrBatch(const std::string& family,
+                ConstrNames& names,
+                const std::size_t nbRows);
+
+    /**
+     * @brief Appends a term to the current row.
+    */
+    void addTerm(const double coeff, const GRBVar& var);
+
+    /**
+     * @brief Closes the current row: terms <sense> rhs.
+     * @param: sense (GRB_LESS_EQUAL, GRB_GREATER_EQUAL or GRB_EQUAL).
+     * @param: right-hand side.
+     * @param: name prefix.
+     * @param: name ids.
+    */
+    void endRow(const char sense,
+                const double rhs,
+                const char* prefix,
+                std::initializer_list<int> ids);
+
+    /**
+     * @brief Adds the rows and logs the build time of the family.
+     * @param: model.
+     * @param: (output) the new constraints are appended to it (if not null).
+    */
+    void addToModel(GRBModel& model, std::vector<GRBConstr>* pConstrs);
+
+private:
+
+    std::string mFamily;
+    ConstrNames& mNames;
+    std::chrono::steady_clock::time_point mStart;
+
+    // current row
+    std::vector<double> mCoeffs;
+    std::vector<GRBVar> mVars;
+
+    std::vector<GRBLinExpr> mExprs;
+    std::vector<char> mSenses;
+    std::vector<double> mRHS;
+};
+
 /**
  * @brief:.
  * @param:.
@@ -42,7 +162,8 @@ void inventoryLevelVariables(GRBModel& model,
  * @param:.
 */
 void quantityVariables(GRBModel& model,
-                       std::vector<std::vector<std::vector<GRBVar>>>& q,
+                       std::vector<GRBVar>& vars,
+                       const VarIndex& idx,
                        const std::shared_ptr<const Instance>& pInst);
 
 
@@ -53,7 +174,8 @@ void quantityVariables(GRBModel& model,
  * @param:.
 */
 void visitationVariables(GRBModel& model,
-                         std::vector<std::vector<std::vector<GRBVar>>>& y,
+                         std::vector<GRBVar>& vars,
+                         const VarIndex& idx,
                          const std::shared_ptr<const Instance>& pInst);
 
 /**
@@ -64,9 +186,25 @@ void visitationVariables(GRBModel& model,
 */
 void routingVariables(
     GRBModel& model,
-    std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
+    std::vector<GRBVar>& vars,
+    const VarIndex& idx,
     const std::shared_ptr<const Instance>& pInst);
 
+/**
+ * @brief Names the variables (I_i_t, q_i_k_t, y_i_k_t and x_i_j_k_t), which
+ * are created unnamed. Only needed to write the model or its IIS.
+ * @param: model.
+ * @param: inventory level variables.
+ * @param: q, y and x variables (VarIndex order).
+ * @param: positions of the q, y and x variables.
+ * @param: instance.
+*/
+void variableNames(GRBModel& model,
+                   const std::vector<std::vector<GRBVar>>& I,
+                   const std::vector<GRBVar>& vars,
+                   const VarIndex& idx,
+                   const std::shared_ptr<const Instance>& pInst);
+
 /**
  * @brief:.
  * @param:.
@@ -74,13 +212,16 @@ void routingVariables(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void inventoryDefDepotConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
@@ -89,13 +230,16 @@ void inventoryDefDepotConstrs(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void stockOutDepotConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
@@ -104,13 +248,16 @@ void stockOutDepotConstrs(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void inventoryDefCustomersConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
@@ -122,7 +269,8 @@ void inventoryDefCustomersConstrs(
 */
 void capacityConstrs(GRBModel& model,
                      std::vector<GRBConstr>& constrs,
-                     const std::vector<std::vector<std::vector<GRBVar>>>& q,
+                     const std::vector<GRBVar>& vars,
+                     const VarIndex& idx,
                      const std::shared_ptr<const Instance>& pInst);
 
 /**
@@ -132,13 +280,16 @@ void capacityConstrs(GRBModel& model,
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void inventoryLevelConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
@@ -147,13 +298,16 @@ void inventoryLevelConstrs(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void mlQuantityCapacityConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
@@ -162,14 +316,16 @@ void mlQuantityCapacityConstrs(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void ouQuantityCapacityConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
@@ -178,13 +334,15 @@ void ouQuantityCapacityConstrs(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void quantitiesRoutingConstraint(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
@@ -193,13 +351,15 @@ void quantitiesRoutingConstraint(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void capacityVehicleConstraint(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
@@ -208,13 +368,15 @@ void capacityVehicleConstraint(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void degreeConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 
 /**
@@ -224,24 +386,37 @@ void degreeConstrs(
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void subtourEliminationConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
-    const std::shared_ptr<const Instance>& pInst);
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    ConstrNames& names);
 
 /**
  * @brief:.
  * @param:.
  * @param:.
  * @param:.
+ * @param: (output) name keys of the new constraints.
 */
 void noSplitDelivery(GRBModel& model,
-                     const std::vector<std::vector<std::vector<GRBVar>>>& y,
-                     const std::shared_ptr<const Instance>& pInst);
+                     const std::vector<GRBVar>& vars,
+                     const VarIndex& idx,
+                     const std::shared_ptr<const Instance>& pInst,
+                     ConstrNames& names);
 
 } // init namespace
 
+////////////////////////////////// inline //////////////////////////////////////
+
+inline void init::ConstrBatch::addTerm(const double coeff, const GRBVar& var)
+{
+    mCoeffs.push_back(coeff);
+    mVars.push_back(var);
+}
+
 #endif // INIT_IRP_MODE_HPP
\ No newline at end of file
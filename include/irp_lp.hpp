@@ -26,7 +26,9 @@
 #include "gurobi_c++.h"
 
 #include "config_parameters.hpp"
+#include "init_grb_model.hpp"
 #include "instance.hpp"
+#include "var_index.hpp"
 #include "callback/callback_sec.hpp"
 
 class Irp_lp
@@ -62,18 +64,28 @@ private:
     GRBEnv mEnv;
     GRBModel mModel;
     std::vector<GRBConstr> mConstrs;
+    // name keys of the constraints not named yet
+    init::ConstrNames mConstrNames;
 
     // inventory level variables
     std::vector<std::vector<GRBVar>> mI;
-    // product quantity shipped to the retailer by vehicle k
-    std::vector<std::vector<std::vector<GRBVar>>> m_q;
-    /* equal to one if j immediately follows i in the route traveled at time t
-       by vehicle k */
-    std::vector<std::vector<std::vector<std::vector<GRBVar>>>> m_x;
-    // retailer i is served at time t by vehicle k
-    std::vector<std::vector<std::vector<GRBVar>>> m_y;
+    // positions of the q, y and x variables in mVars
+    VarIndex mIdx;
+    /* q: product quantity shipped to the retailer by vehicle k;
+       y: retailer i is served at time t by vehicle k;
+       x: equal to one if j immediately follows i in the route traveled at time
+       t by vehicle k (i < j only) */
+    std::vector<GRBVar> mVars;
+    // variables and constraints are named on demand (by the write methods)
+    bool mNamed;
 
     CallbackSEC mCbSEC;
+
+    /**
+     * @brief Names the variables and the constraints if they are not named
+     * yet.
+    */
+    void nameModel();
 };
 
 #endif // IRP_LP_HPP
\ No newline at end of file
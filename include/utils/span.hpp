@@ -0,0 +1,71 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: span.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Non-owning view of a contiguous array (a minimal std::span, which
+ * is C++20).
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 18, 2026, 01:40 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTILS_SPAN_HPP
+#define UTILS_SPAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+namespace utils
+{
+
+template<typename T>
+class Span
+{
+public:
+
+    Span() : mpData(nullptr), mSize(0) {}
+
+    Span(T* pData, const std::size_t size) : mpData(pData), mSize(size) {}
+
+    /**
+     * @brief Views the whole vector (Span<const T> also views a non-const
+     * vector).
+    */
+    template<typename U,
+             typename = std::enable_if_t<std::is_same<std::remove_const_t<T>,
+                                                      U>::value>>
+    Span(std::vector<U>& v) : mpData(v.data()), mSize(v.size()) {}
+
+    template<typename U,
+             typename = std::enable_if_t<std::is_const<T>::value &&
+                                         std::is_same<std::remove_const_t<T>,
+                                                      U>::value>>
+    Span(const std::vector<U>& v) : mpData(v.data()), mSize(v.size()) {}
+
+    T* data() const {return mpData;}
+
+    std::size_t size() const {return mSize;}
+
+    bool empty() const {return mSize == 0;}
+
+    T& operator[](const std::size_t i) const {return mpData[i];}
+
+    T* begin() const {return mpData;}
+
+    T* end() const {return mpData + mSize;}
+
+private:
+
+    T* mpData;
+    std::size_t mSize;
+};
+
+} // utils namespace
+
+#endif // UTILS_SPAN_HPP
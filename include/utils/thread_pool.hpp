@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: thread_pool.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Fixed-size pool of worker threads for fork-join loops, class
+ * declaration.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 10:05 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef UTILS_THREAD_POOL_HPP
+#define UTILS_THREAD_POOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace utils
+{
+
+class ThreadPool
+{
+public:
+
+    ThreadPool() = delete;
+    ThreadPool(const ThreadPool& other) = delete;
+    ThreadPool(ThreadPool&& other) = delete;
+    ThreadPool& operator=(const ThreadPool& other) = delete;
+    ThreadPool& operator=(ThreadPool&& other) = delete;
+
+    /**
+     * @brief Starts nbThreads - 1 workers (the calling thread is the other
+     * one, see parallelFor()).
+     * @param: total number of threads.
+    */
+    explicit ThreadPool(const std::size_t nbThreads);
+
+    ~ThreadPool();
+
+    /**
+     * @brief Total number of threads (workers plus the calling thread).
+    */
+    std::size_t getNbThreads() const;
+
+    /**
+     * @brief Runs task(i) for every i in [0, nbTasks) on the pool and on the
+     * calling thread and returns when all of them are finished. Tasks are
+     * handed out dynamically, so task must not depend on the execution order.
+     * @param: number of tasks.
+     * @param: task.
+    */
+    void parallelFor(const int nbTasks, const std::function<void(int)>& task);
+
+private:
+
+    std::vector<std::thread> mWorkers;
+
+    std::mutex mMutex;
+    std::condition_variable mCvWork;
+    std::condition_variable mCvDone;
+
+    // current loop (valid while mNbBusy > 0)
+    const std::function<void(int)>* mpTask;
+    int mNbTasks;
+    std::atomic<int> mNextTask;
+
+    // number of workers still running the current loop
+    std::size_t mNbBusy;
+    // incremented for every new loop so workers do not run one twice
+    std::size_t mGeneration;
+    bool mStop;
+
+    void workerLoop();
+
+    void runTasks();
+};
+
+} // utils namespace
+
+#endif // UTILS_THREAD_POOL_HPP
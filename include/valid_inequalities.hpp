@@ -0,0 +1,164 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: valid_inequalities.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief IRP valid inequalities (added to the model or separated as user
+ * cuts), class declaration.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 08:15 PM
+ *
+ * References:
+ * [1] C. Archetti, L. Bertazzi, G. Laporte and M. G. Speranza. A Branch-and-Cut
+ * Algorithm for a Vendor-Managed Inventory-Routing Problem. Transportation
+ * Science, 41(3), 2007, pp. 382-391.
+ * [2] L. C. Coelho and G. Laporte. The exact solution of several classes of
+ * inventory-routing problems. Computers & Operations Research, 40(2), 2013,
+ * pp. 558-565.
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef VALID_INEQUALITIES_HPP
+#define VALID_INEQUALITIES_HPP
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "gurobi_c++.h"
+
+#include "init_grb_model.hpp"
+#include "instance.hpp"
+#include "var_index.hpp"
+
+class ValidInequalities
+{
+public:
+
+    /**
+     * @brief Families of valid inequalities:
+     * depotEdge:  x_0ikt <= 2 y_ikt;
+     * depotVisit: y_ikt <= y_0kt;
+     * minVisits:  sum_{t1..t2} sum_k y_ikt >= ceil((r_i(t1, t2) - S) / B_i),
+     *             S = I_i0 if t1 = 0 (U_i otherwise), B_i = min(U_i, C_k);
+     * inventory:  I_it1 >= r_i(t1, t2) (1 - sum_{t1..t2} sum_k y_ikt), I_it1
+     *             written with I_i0 and the q (inventory definition).
+    */
+    enum class family {depotEdge, depotVisit, minVisits, inventory};
+    static constexpr int nbFamilies = 4;
+
+    ValidInequalities(const ValidInequalities& other) = default;
+    ValidInequalities(ValidInequalities&& other) = default;
+    ~ValidInequalities() = default;
+
+    ValidInequalities() = delete;
+    ValidInequalities& operator=(const ValidInequalities& other) = delete;
+    ValidInequalities& operator=(ValidInequalities&& other) = delete;
+
+    /**
+     * @brief Empty set of inequalities.
+     * @param: positions of the q, y and x variables.
+     * @param: instance.
+    */
+    ValidInequalities(const VarIndex& idx,
+                      const std::shared_ptr<const Instance>& pInst);
+
+    /**
+     * @brief Generates all the inequalities of a family.
+     * @param: family.
+    */
+    void addFamily(const family f);
+
+    /**
+     * @brief True if no family was added.
+    */
+    bool empty() const;
+
+    /**
+     * @brief Adds every inequality to the model (a single addConstrs()).
+     * @param: model.
+     * @param: constraints of the model (the new ones are appended).
+     * @param: q, y and x variables (VarIndex order).
+     * @param: (output) name keys of the new constraints (VI_<family>_<c>).
+    */
+    void addToModel(GRBModel& model,
+                    std::vector<GRBConstr>& constrs,
+                    const std::vector<GRBVar>& vars,
+                    init::ConstrNames& names) const;
+
+    /**
+     * @brief Calls addCut() for every inequality violated by a solution.
+     * @param: q, y and x values (VarIndex order).
+     * @param: minimum violation.
+     * @param: (output) number of violated inequalities per family.
+     * @param: function adding the cut (lhs <= rhs) to the model.
+    */
+    template<typename F>
+    void separate(const std::vector<double>& vals,
+                  const double eps,
+                  std::vector<std::size_t>& nbViolated,
+                  F addCut) const;
+
+    /**
+     * @brief Family name (cfg, statistics and constraint names).
+    */
+    static std::string getName(const family f);
+
+private:
+
+    // sum_i val[i] * vars[ind[i]] <= rhs
+    struct row
+    {
+        family f;
+        std::vector<int> ind;
+        std::vector<double> val;
+        double rhs;
+    };
+
+    VarIndex mIdx;
+
+    std::shared_ptr<const Instance> mpInst;
+
+    std::vector<row> mRows;
+
+    void addRow(const family f,
+                std::vector<int>&& ind,
+                std::vector<double>&& val,
+                const double rhs);
+
+    void addDepotEdge();
+
+    void addDepotVisit();
+
+    void addMinVisits();
+
+    void addInventory();
+};
+
+////////////////////////////////// template ////////////////////////////////////
+
+template<typename F>
+void ValidInequalities::separate(const std::vector<double>& vals,
+                                 const double eps,
+                                 std::vector<std::size_t>& nbViolated,
+                                 F addCut) const
+{
+    for (const auto& r : mRows)
+    {
+        double lhs = 0;
+        for (std::size_t i = 0; i < r.ind.size(); ++i)
+        {
+            lhs += r.val[i] * vals[r.ind[i]];
+        }
+
+        if (lhs - r.rhs > eps)
+        {
+            ++nbViolated[static_cast<int>(r.f)];
+            addCut(r.ind, r.val, r.rhs);
+        }
+    }
+}
+
+#endif // VALID_INEQUALITIES_HPP
@@ -0,0 +1,171 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: var_index.hpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Index layer of the flat (contiguous) storage of the q, y and x
+ * variables (and of their values): class declaration and inline definitions.
+ *
+ * The variables are laid out in three consecutive blocks, q, y and x. Inside
+ * each block the (k, t) pairs are the outer index, so the variables of one
+ * (vehicle, period) support graph are contiguous:
+ *   q(i, k, t), 1 <= i < n:      (k * T + t) * (n - 1) + (i - 1)
+ *   y(i, k, t), 0 <= i < n:      (k * T + t) * n + i
+ *   x(i, j, k, t), 0 <= i < j < n (upper triangle only):
+ *                                (k * T + t) * n * (n - 1) / 2 + e(i, j)
+ * where e(i, j) enumerates the edges row by row.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 01:40 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef VAR_INDEX_HPP
+#define VAR_INDEX_HPP
+
+class VarIndex
+{
+public:
+
+    VarIndex() = default;
+    VarIndex(const VarIndex& other) = default;
+    VarIndex(VarIndex&& other) = default;
+    ~VarIndex() = default;
+    VarIndex& operator=(const VarIndex& other) = default;
+    VarIndex& operator=(VarIndex&& other) = default;
+
+    /**
+     * @brief.
+     * @param: number of vertices (depot and customers).
+     * @param: number of vehicles.
+     * @param: number of periods.
+    */
+    VarIndex(const int nbVertices, const int K, const int T);
+
+    /**
+     * @brief Position of q_ikt (i >= 1).
+    */
+    int q(const int i, const int k, const int t) const;
+
+    /**
+     * @brief Position of y_ikt.
+    */
+    int y(const int i, const int k, const int t) const;
+
+    /**
+     * @brief Position of x_ijkt (i < j).
+    */
+    int x(const int i, const int j, const int k, const int t) const;
+
+    /**
+     * @brief Position of the first x variable of (k, t); the edges of (k, t)
+     * follow in e(i, j) order.
+    */
+    int xBegin(const int k, const int t) const;
+
+    /**
+     * @brief Edge number e(i, j) (i < j) inside a (k, t) x block.
+    */
+    int edge(const int i, const int j) const;
+
+    int getNbEdges() const;
+
+    int getNbq() const;
+
+    int getNby() const;
+
+    int getNbx() const;
+
+    /**
+     * @brief Total number of positions (q, y and x).
+    */
+    int size() const;
+
+private:
+
+    int mN = 0;
+    int mT = 0;
+    // # of edges (i < j)
+    int mNbEdges = 0;
+    // first position of the blocks
+    int mYOffset = 0;
+    int mXOffset = 0;
+    int mSize = 0;
+};
+
+////////////////////////////////// inline //////////////////////////////////////
+
+inline VarIndex::VarIndex(const int nbVertices, const int K, const int T) :
+    mN(nbVertices),
+    mT(T),
+    mNbEdges(nbVertices * (nbVertices - 1) / 2),
+    mYOffset(K * T * (nbVertices - 1)),
+    mXOffset(mYOffset + K * T * nbVertices),
+    mSize(mXOffset + K * T * mNbEdges)
+{}
+
+
+inline int VarIndex::q(const int i, const int k, const int t) const
+{
+    return (k * mT + t) * (mN - 1) + (i - 1);
+}
+
+
+inline int VarIndex::y(const int i, const int k, const int t) const
+{
+    return mYOffset + (k * mT + t) * mN + i;
+}
+
+
+inline int VarIndex::x(const int i, const int j, const int k, const int t)
+    const
+{
+    return xBegin(k, t) + edge(i, j);
+}
+
+
+inline int VarIndex::xBegin(const int k, const int t) const
+{
+    return mXOffset + (k * mT + t) * mNbEdges;
+}
+
+
+inline int VarIndex::edge(const int i, const int j) const
+{
+    return i * mN - i * (i + 1) / 2 + (j - i - 1);
+}
+
+
+inline int VarIndex::getNbEdges() const
+{
+    return mNbEdges;
+}
+
+
+inline int VarIndex::getNbq() const
+{
+    return mYOffset;
+}
+
+
+inline int VarIndex::getNby() const
+{
+    return mXOffset - mYOffset;
+}
+
+
+inline int VarIndex::getNbx() const
+{
+    return mSize - mXOffset;
+}
+
+
+inline int VarIndex::size() const
+{
+    return mSize;
+}
+
+#endif // VAR_INDEX_HPP
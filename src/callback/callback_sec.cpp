@@ -16,11 +16,16 @@
  */
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <chrono>
+
 #include "../../include/ext/loguru/loguru.hpp"
 
 #include "../../include/callback/callback_sec.hpp"
 #include "../../include/ext/cvrpsep/capsep.h"
 #include "../../include/ext/cvrpsep/cnstrmgr.h"
+#include "../../include/ext/cvrpsep/memmod.h"
+#include "../../include/utils/constants.hpp"
 
 ////////////////////////////////////////////////////////////////////////////////
 
@@ -29,151 +34,237 @@ namespace
 
 static const int C_EPS = 1e-5;
 
-} // anonymous namespace
+// period (in seconds) of the separation statistics log line
+static const double cStatsLogPeriod = 30.0;
 
-////////////////////////////////////////////////////////////////////////////////
+// maximum number of capacity cuts of one CVRPSEP separation
+static const int cMaxNbCapCuts = 8;
 
-CallbackSEC::CallbackSEC(
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::shared_ptr<const Instance>& p_inst) :
-        m_q(q),
-        m_x(x),
-        m_y(y),
-        mpInst(p_inst)
-{}
+} // anonymous namespace
 
+////////////////////////////////////////////////////////////////////////////////
 
-void CallbackSEC::callback()
+CallbackSEC::CallbackSEC(const std::vector<GRBVar>& vars,
+                         const VarIndex& idx,
+                         const std::shared_ptr<const Instance>& p_inst) :
+        mVars(vars),
+        mIdx(idx),
+        mpInst(p_inst),
+        mVals(idx.size(), 0),
+        mSupport(idx,
+                 p_inst->getNbVertices(),
+                 p_inst->getK(),
+                 p_inst->getT(),
+                 false),
+        mAggSupport(idx,
+                    p_inst->getNbVertices(),
+                    p_inst->getK(),
+                    p_inst->getT(),
+                    true),
+        mAggregatedSep(false),
+        mPropagateSep(false),
+        mExactSepNodes(0),
+        mCapSep(true),
+        mMstarSep(false),
+        mQCapSep(false),
+        mValidIneqs(idx, p_inst),
+        mStats(p_inst->getK(), p_inst->getT()),
+        mScheduler(1, 0, 0),
+        mNbRetrievals(0),
+        mRetrievalTime(0),
+        mCutPool(p_inst->getK(), p_inst->getT()),
+        mAggCutPool(1, p_inst->getT())
 {
-    try
+    const int nbGraphs = p_inst->getK() * p_inst->getT();
+    mCapSeparators.reserve(nbGraphs);
+    for (int kt = 0; kt < nbGraphs; ++kt)
     {
-        if (where == GRB_CB_MIPSOL)
-        {
-            addCVRPSEPCAP(constrsType::lazy);
-        }
-        else if (where == GRB_CB_MIPNODE &&
-                 getIntInfo(GRB_CB_MIPNODE_STATUS) == GRB_OPTIMAL)
-        {
-            addCVRPSEPCAP(constrsType::cut);
-        }
+        mCapSeparators.emplace_back(cMaxNbCapCuts, utils::GRB_EPSILON);
     }
-    catch (GRBException& e)
+
+    mAggCapSeparators.reserve(p_inst->getT());
+    for (int t = 0; t < p_inst->getT(); ++t)
     {
-        RAW_LOG_F(ERROR, "callback() exp: %s", e.getMessage().c_str());
+        mAggCapSeparators.emplace_back(cMaxNbCapCuts, utils::GRB_EPSILON);
     }
-    catch (...)
+}
+
+
+void CallbackSEC::setNbSepThreads(const std::size_t nbThreads)
+{
+    if (nbThreads > 1)
     {
-        RAW_LOG_F(ERROR, "callback(): Unknown Exception");
+        mpSepPool = std::make_unique<utils::ThreadPool>(nbThreads);
+    }
+    else
+    {
+        mpSepPool.reset();
     }
 }
 
-/* -------------------------------------------------------------------------- */
 
-std::vector<std::vector<std::vector<double>>> CallbackSEC::getqVarsValues(
-    const constrsType cstType)
+void CallbackSEC::setAggregatedSep(const bool aggregated)
 {
-    std::vector<std::vector<std::vector<double>>> qVal(
-        mpInst->getNbVertices(), std::vector<std::vector<double>>(
-            mpInst->getK(), std::vector<double>(mpInst->getT(), 0)
-        )
-    );
+    mAggregatedSep = aggregated;
+}
+
+
+void CallbackSEC::setSepPropagation(const bool propagate)
+{
+    mPropagateSep = propagate;
+}
+
+
+void CallbackSEC::setSepScheduler(const std::size_t nodeFreq,
+                                  const double minViolation,
+                                  const double backoffGain)
+{
+    mScheduler = SepScheduler(nodeFreq, minViolation, backoffGain);
+}
 
-    for (int i = 1; i < mpInst->getNbVertices(); ++i)
-    {
-        for (int k = 0; k < mpInst->getK(); ++k)
-        {
-            for (int t = 0; t < mpInst->getT(); ++t)
-            {
-                DCHECK_F(i < static_cast<int>(m_q.size()));
-                DCHECK_F(k < static_cast<int>(m_q[i].size()));
-                DCHECK_F(t < static_cast<int>(m_q[i][k].size()));
-                if (cstType == constrsType::lazy)
-                {
-                    qVal[i][k][t] = getSolution(m_q[i][k][t]);
-                }
-                else
-                {
-                    qVal[i][k][t] = getNodeRel(m_q[i][k][t]);
-                }
-            }
-        }
-    }
 
-    return qVal;
+void CallbackSEC::setExactSep(const std::size_t nbNodes)
+{
+    mExactSepNodes = nbNodes;
+}
+
+
+void CallbackSEC::setCutFamilies(const bool capSep,
+                                 const bool mstarSep,
+                                 const bool qcapSep)
+{
+    mCapSep = capSep;
+    mMstarSep = mstarSep;
+    mQCapSep = qcapSep;
 }
 
 
-std::vector<std::vector<std::vector<std::vector<double>>>>
-    CallbackSEC::getxVarsValues(const constrsType cstType)
+void CallbackSEC::addValidIneqFamily(const ValidInequalities::family f)
 {
-    std::vector<std::vector<std::vector<std::vector<double>>>> xVal(
-        mpInst->getNbVertices(), std::vector<std::vector<std::vector<double>>>(
-            mpInst->getNbVertices(), std::vector<std::vector<double>>(
-                mpInst->getK(), std::vector<double>(mpInst->getT(), 0)
-            )
-        )
-    );
-
-    for (int i = 0; i < mpInst->getNbVertices(); ++i)
+    mValidIneqs.addFamily(f);
+}
+
+
+void CallbackSEC::showStats() const
+{
+    mStats.show();
+    mCutPool.show();
+    if (mAggregatedSep)
     {
-        for (int j = i + 1; j < mpInst->getNbVertices(); ++j)
-        {
-            for (int k = 0; k < mpInst->getK(); ++k)
-            {
-                for (int t = 0; t < mpInst->getT(); ++t)
-                {
-                    DCHECK_F(i < static_cast<int>(m_x.size()));
-                    DCHECK_F(j < static_cast<int>(m_x[i].size()));
-                    DCHECK_F(k < static_cast<int>(m_x[i][j].size()));
-                    DCHECK_F(t < static_cast<int>(m_x[i][j][k].size()));
-                    if (cstType == constrsType::lazy)
-                    {
-                        xVal[i][j][k][t] = getSolution(m_x[i][j][k][t]);
-                    }
-                    else
-                    {
-                        xVal[i][j][k][t] = getNodeRel(m_x[i][j][k][t]);
-                    }
-                }
-            }
-        }
+        mAggCutPool.show();
     }
-
-    return xVal;
+    RAW_LOG_F(INFO, "Solution retrieval: %zu calls, %.3f s (%.2f us per call)",
+              mNbRetrievals, mRetrievalTime,
+              mNbRetrievals > 0 ? 1e6 * mRetrievalTime / mNbRetrievals : 0.0);
+    RAW_LOG_F(INFO, "CVRPSEP work buffers: arena peak %.1f KiB per separation",
+              MemArenaPeak() / 1024.0);
 }
 
 
-std::vector<std::vector<std::vector<double>>> CallbackSEC::getyVarsValues(
-        const constrsType cstType)
+void CallbackSEC::writeStatsJSON(const std::string& path) const
 {
-    std::vector<std::vector<std::vector<double>>> yVal(
-        mpInst->getNbVertices(), std::vector<std::vector<double>>(
-            mpInst->getK(), std::vector<double>(mpInst->getT(), 0)
-        )
-    );
+    mStats.writeJSON(path);
+}
 
-    for (int i = 0; i < mpInst->getNbVertices(); ++i)
+
+void CallbackSEC::callback()
+{
+    try
     {
-        for (int k = 0; k < mpInst->getK(); ++k)
+        mStats.addCall(where);
+        const auto start = std::chrono::steady_clock::now();
+
+        if (where == GRB_CB_MIPSOL)
+        {
+            addIntegerSEC();
+        }
+        else if (where == GRB_CB_MIPNODE &&
+                 getIntInfo(GRB_CB_MIPNODE_STATUS) == GRB_OPTIMAL)
         {
-            for (int t = 0; t < mpInst->getT(); ++t)
+            const double nodeCount = getDoubleInfo(GRB_CB_MIPNODE_NODCNT);
+            if (!mScheduler.isDue(nodeCount,
+                                  getDoubleInfo(GRB_CB_MIPNODE_OBJBND)))
+            {
+                mStats.addSkipped();
+                return;
+            }
+
+            double maxViolation = 0;
+            if (nodeCount < mExactSepNodes)
+            {
+                addExactSEC(constrsType::cut, maxViolation);
+            }
+            else if (!mCapSep)
+            {
+                getVarsValues(constrsType::cut);
+            }
+            else if (mAggregatedSep)
+            {
+                addCVRPSEPCAPAggregated(constrsType::cut, maxViolation);
+            }
+            else
+            {
+                addCVRPSEPCAP(constrsType::cut, maxViolation);
+            }
+
+            /* on the values retrieved above */
+            if (mMstarSep)
             {
-                DCHECK_F(i < static_cast<int>(m_y.size()));
-                DCHECK_F(k < static_cast<int>(m_y[i].size()));
-                DCHECK_F(t < static_cast<int>(m_y[i][k].size()));
-                if (cstType == constrsType::lazy)
-                {
-                    yVal[i][k][t] = getSolution(m_y[i][k][t]);
-                }
-                else
-                {
-                    yVal[i][k][t] = getNodeRel(m_y[i][k][t]);
-                }
+                double mstarViolation = 0;
+                addMultistarCuts(constrsType::cut, mstarViolation);
+                maxViolation = std::max(maxViolation, mstarViolation);
             }
+            if (mQCapSep)
+            {
+                double qcapViolation = 0;
+                addQCapacityCuts(constrsType::cut, qcapViolation);
+                maxViolation = std::max(maxViolation, qcapViolation);
+            }
+            if (!mValidIneqs.empty())
+            {
+                addValidIneqCuts();
+            }
+            mScheduler.record(maxViolation);
         }
+        else
+        {
+            return;
+        }
+
+        mStats.addSepTime(where, std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count());
+
+        if (mStats.isLogDue(cStatsLogPeriod))
+        {
+            mStats.show();
+        }
+    }
+    catch (GRBException& e)
+    {
+        RAW_LOG_F(ERROR, "callback() exp: %s", e.getMessage().c_str());
     }
+    catch (...)
+    {
+        RAW_LOG_F(ERROR, "callback(): Unknown Exception");
+    }
+}
 
-    return yVal;
-}
\ No newline at end of file
+/* -------------------------------------------------------------------------- */
+
+void CallbackSEC::getVarsValues(const constrsType cstType)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    DCHECK_F(static_cast<int>(mVars.size()) == mIdx.size());
+
+    /* the array overloads return a new[] allocated array */
+    double* vals = cstType == constrsType::lazy ?
+        getSolution(mVars.data(), mIdx.size()) :
+        getNodeRel(mVars.data(), mIdx.size());
+    std::copy(vals, vals + mIdx.size(), mVals.begin());
+    delete[] vals;
+
+    ++mNbRetrievals;
+    mRetrievalTime += std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start).count();
+}
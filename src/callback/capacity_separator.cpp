@@ -0,0 +1,185 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: capacity_separator.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief CVRPSEP capacity cuts separation (CAPSEP_SeparateCapCuts) of one
+ * support graph, class definition.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 18, 2026, 01:40 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/ext/cvrpsep/capsep.h"
+#include "../../include/ext/cvrpsep/memmod.h"
+#include "../../include/ext/loguru/loguru.hpp"
+
+#include "../../include/callback/capacity_separator.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+static const int cDim = 100; // initial dimension of the constraint manager
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+std::size_t CapacitySeparator::CutBatch::size() const
+{
+    return mOffsets.size();
+}
+
+
+utils::Span<const int> CapacitySeparator::CutBatch::getNodes(
+    const std::size_t c) const
+{
+    DCHECK_F(c < mOffsets.size());
+    return utils::Span<const int>(mNodes.data() + mOffsets[c] + 1,
+                                  mNodes[mOffsets[c]]);
+}
+
+
+const int* CapacitySeparator::CutBatch::getIntList(const std::size_t c) const
+{
+    DCHECK_F(c < mOffsets.size());
+    return mNodes.data() + mOffsets[c];
+}
+
+
+double CapacitySeparator::CutBatch::getRHS(const std::size_t c) const
+{
+    DCHECK_F(c < mRHS.size());
+    return mRHS[c];
+}
+
+
+void CapacitySeparator::CutBatch::clear()
+{
+    mOffsets.clear();
+    mNodes.clear();
+    mRHS.clear();
+}
+
+
+void CapacitySeparator::CutBatch::add(const int intListSize,
+                                      const int* intList,
+                                      const double rhs)
+{
+    mOffsets.push_back(mNodes.size());
+    mNodes.push_back(intListSize);
+    mNodes.insert(mNodes.end(), intList + 1, intList + intListSize + 1);
+    mRHS.push_back(rhs);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+
+CapacitySeparator::CapacitySeparator(const int maxNbCuts,
+                                     const double epsIntegrality) :
+    mMaxNbCuts(maxNbCuts),
+    mEpsIntegrality(epsIntegrality),
+    mMaxViolation(0),
+    mIntegerAndFeasible(false)
+{
+    CnstrMgrPointer cmp;
+    CMGR_CreateCMgr(&cmp, cDim);
+    mpCutsCMP.reset(cmp);
+}
+
+
+const CapacitySeparator::CutBatch& CapacitySeparator::separate(
+    const int nbCustomers,
+    const int capacity,
+    utils::Span<const int> demand,
+    utils::Span<const int> edgeTail,
+    utils::Span<const int> edgeHead,
+    utils::Span<const double> edgeX,
+    CnstrMgrPointer existingCuts)
+{
+    DCHECK_F(demand.size() == static_cast<std::size_t>(nbCustomers));
+    DCHECK_F(edgeHead.size() == edgeTail.size());
+    DCHECK_F(edgeX.size() == edgeTail.size());
+
+    mCuts.clear();
+    mMaxViolation = 0;
+    mIntegerAndFeasible = false;
+
+    const int nbEdges = static_cast<int>(edgeTail.size());
+    if (nbEdges == 0) return mCuts;
+
+    /* CVRPSEP arrays are 1-based */
+    mDemand.assign(1, 0);
+    mDemand.insert(mDemand.end(), demand.begin(), demand.end());
+    mEdgeTail.assign(1, 0);
+    mEdgeTail.insert(mEdgeTail.end(), edgeTail.begin(), edgeTail.end());
+    mEdgeHead.assign(1, 0);
+    mEdgeHead.insert(mEdgeHead.end(), edgeHead.begin(), edgeHead.end());
+    mEdgeX.assign(1, 0);
+    mEdgeX.insert(mEdgeX.end(), edgeX.begin(), edgeX.end());
+
+    CnstrMgrPointer cutsCMP = mpCutsCMP.get();
+    for (int c = 0; c < cutsCMP->Size; ++c)
+    {
+        CMGR_ClearCnstr(cutsCMP, c);
+    }
+    CMGR_CompressCMP(cutsCMP);
+
+    char integerAndFeasible = 0;
+    MemArenaBegin();
+    CAPSEP_SeparateCapCuts(nbCustomers,
+                           mDemand.data(),
+                           capacity,
+                           nbEdges,
+                           mEdgeTail.data(),
+                           mEdgeHead.data(),
+                           mEdgeX.data(),
+                           existingCuts,
+                           mMaxNbCuts,
+                           mEpsIntegrality,
+                           &integerAndFeasible,
+                           &mMaxViolation,
+                           cutsCMP);
+    MemArenaEnd();
+    mIntegerAndFeasible = integerAndFeasible != 0;
+
+    for (int c = 0; c < cutsCMP->Size; ++c)
+    {
+        if (cutsCMP->CPL[c]->CType != CMGR_CT_CAP) continue;
+
+        mCuts.add(cutsCMP->CPL[c]->IntListSize,
+                  cutsCMP->CPL[c]->IntList,
+                  cutsCMP->CPL[c]->RHS);
+    }
+
+    return mCuts;
+}
+
+
+const CapacitySeparator::CutBatch& CapacitySeparator::getCuts() const
+{
+    return mCuts;
+}
+
+
+double CapacitySeparator::getMaxViolation() const
+{
+    return mMaxViolation;
+}
+
+
+bool CapacitySeparator::isIntegerAndFeasible() const
+{
+    return mIntegerAndFeasible;
+}
+
+
+void CapacitySeparator::cmgrDeleter::operator()(CnstrMgrPointer p) const
+{
+    CMGR_FreeMemCMgr(&p);
+}
@@ -0,0 +1,125 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: cut_pool.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Long-lived pool of CVRPSEP capacity cuts, one constraint manager per
+ * (vehicle, period) pair, class definition.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 09:10 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/ext/loguru/loguru.hpp"
+
+#include "../../include/callback/cut_pool.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+static const int cDim = 100; // initial dimension of each constraint manager
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+CutPool::CutPool(const int K, const int T) :
+    mT(T),
+    mEntries(K * T)
+{
+    for (auto& e : mEntries)
+    {
+        CnstrMgrPointer cmp;
+        CMGR_CreateCMgr(&cmp, cDim);
+        e.cmp.reset(cmp);
+        e.nbLookups = 0;
+        e.nbHits = 0;
+    }
+}
+
+
+bool CutPool::addCap(const int k,
+                     const int t,
+                     const int intListSize,
+                     const int* intList,
+                     const double rhs)
+{
+    DCHECK_F(k * mT + t < static_cast<int>(mEntries.size()));
+    auto& e = mEntries[k * mT + t];
+    ++e.nbLookups;
+
+    /* CMGR_AddCnstr() does not add a capacity cut already in the manager
+       (hash index lookup) */
+    const int sizeBefore = e.cmp->Size;
+    CMGR_AddCnstr(e.cmp.get(), CMGR_CT_CAP, 0, intListSize,
+                  const_cast<int*>(intList), rhs);
+    if (e.cmp->Size == sizeBefore)
+    {
+        ++e.nbHits;
+        return false;
+    }
+
+    return true;
+}
+
+
+CnstrMgrPointer CutPool::getCMP(const int k, const int t) const
+{
+    DCHECK_F(k * mT + t < static_cast<int>(mEntries.size()));
+    return mEntries[k * mT + t].cmp.get();
+}
+
+
+std::size_t CutPool::getNbLookups() const
+{
+    std::size_t nb = 0;
+    for (const auto& e : mEntries)
+    {
+        nb += e.nbLookups;
+    }
+    return nb;
+}
+
+
+std::size_t CutPool::getNbHits() const
+{
+    std::size_t nb = 0;
+    for (const auto& e : mEntries)
+    {
+        nb += e.nbHits;
+    }
+    return nb;
+}
+
+
+std::size_t CutPool::getSize() const
+{
+    std::size_t nb = 0;
+    for (const auto& e : mEntries)
+    {
+        nb += e.cmp->Size;
+    }
+    return nb;
+}
+
+
+void CutPool::show() const
+{
+    const auto nbLookups = getNbLookups();
+    const auto nbHits = getNbHits();
+    RAW_LOG_F(INFO, "CVRPSEP cut pool: %zu cuts stored, %zu lookups, "
+              "%zu hits (%.2f%%)", getSize(), nbLookups, nbHits,
+              nbLookups > 0 ? 100.0 * nbHits / nbLookups : 0.0);
+}
+
+
+void CutPool::cmgrDeleter::operator()(CnstrMgrPointer p) const
+{
+    CMGR_FreeMemCMgr(&p);
+}
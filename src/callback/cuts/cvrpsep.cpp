@@ -13,23 +13,19 @@
  */
 ////////////////////////////////////////////////////////////////////////////////
 
-#include <cmath>
+#include <algorithm>
 
-#include "../../../include/ext/cvrpsep/capsep.h"
-#include "../../../include/ext/cvrpsep/cnstrmgr.h"
 #include "../../../include/ext/loguru/loguru.hpp"
 
 #include "../../../include/callback/callback_sec.hpp"
 #include "../../../include/utils/constants.hpp"
+#include "../../../include/utils/span.hpp"
 
 ////////////////////////////// Helper functions  ///////////////////////////////
 
 namespace
 {
 
-static const int cDim = 100; // ?
-static const int cMaxNbCapCuts = 8; // ?
-
 /**
  * @brief
 */
@@ -38,173 +34,292 @@ int checkForDepot(const int i, const int n)
     return i == n ? 0 : i;
 }
 
-/*
-* @brief
+/**
+ * @brief Records that the support graph g found the set list.
 */
-std::vector<int> getDemand(
-    const std::vector<std::vector<std::vector<double>>>& qVal,
-    const int k,
-    const int t)
+void addFoundSet(std::map<std::vector<int>, std::vector<char>>& sets,
+                 std::vector<int> list,
+                 const int g,
+                 const int nbGraphs)
 {
-    std::vector<int> demand(qVal.size(), 0);
-
-    for (std::size_t i = 1; i < demand.size(); ++i)
-    {
-        demand[i] = static_cast<int>(std::ceil(qVal[i][k][t]));
-    }
+    std::sort(list.begin(), list.end());
+    auto& foundIn = sets[list];
+    foundIn.resize(nbGraphs, 0);
+    foundIn[g] = 1;
+}
 
-    return demand;
 }
 
-/**
- * @brief
-*/
-std::tuple<int, std::vector<int>, std::vector<int>, std::vector<double>>
-    getEdges(
-        const std::vector<std::vector<std::vector<std::vector<double>>>>& xVal,
-        const int n,
-        const int k,
-        const int t)
+////////////////////////////////////////////////////////////////////////////////
+
+
+int CallbackSEC::addCVRPSEPCAP(const constrsType cstType,
+                               double& maxViolation)
 {
-    int nbEdges = 0;
-    for (int i = 0; i < n; ++i)
+    int nbAdded = 0; // # of lazy/cuts added in this call
+    maxViolation = 0;
+
+    /* get solution: delivery quantities, routing and visitation */
+    getVarsValues(cstType);
+    mSupport.build(mVals, utils::GRB_EPSILON);
+
+    const int n = mpInst->getNbVertices();
+    const int T = mpInst->getT();
+    const int nbGraphs = mpInst->getK() * T;
+
+    /* Separation of each (k, t) support graph. Task kt only uses
+       mCapSeparators[kt] and only reads the pool of its own (k, t), so the
+       tasks may run concurrently. */
+    auto separate = [&](const int kt)
     {
-        for (int j = i + 1; j < n; ++j)
+        const int k = kt / T;
+        const int t = kt % T;
+
+        const int nbEdges = mSupport.getNbEdges(k, t);
+
+        if (nbEdges == 0) return;
+
+        mCapSeparators[kt].separate(
+            n - 1,
+            mpInst->getCk(k),
+            utils::Span<const int>(mSupport.getDemand(k, t) + 1, n - 1),
+            utils::Span<const int>(mSupport.getEdgeTail(k, t), nbEdges),
+            utils::Span<const int>(mSupport.getEdgeHead(k, t), nbEdges),
+            utils::Span<const double>(mSupport.getEdgeX(k, t), nbEdges),
+            mCutPool.getCMP(k, t));
+    };
+
+    if (mpSepPool)
+    {
+        mpSepPool->parallelFor(nbGraphs, separate);
+    }
+    else
+    {
+        for (int kt = 0; kt < nbGraphs; ++kt)
         {
-            if (xVal[i][j][k][t] > utils::GRB_EPSILON)
-            {
-                ++nbEdges;
-            }
+            separate(kt);
         }
     }
-    
-    std::vector<int> edgeTail;
-    std::vector<int> edgeHead;
-    std::vector<double> edgeX;
 
-    if (nbEdges > 0)
+    // sets found in this round (for the propagation)
+    foundSets sets;
+
+    /* The cuts are added in (k, t) order whatever the number of threads, so
+       the model sees the same sequence of lazy/cuts. */
+    std::vector<int> list; // set of the current cut (reused)
+    for (int k = 0; k < mpInst->getK(); ++k)
     {
-        edgeTail.reserve(nbEdges + 1);
-        edgeHead.reserve(nbEdges + 1);
-        edgeX.reserve(nbEdges + 1);
-        /* skip first element */
-        edgeTail.push_back(0); 
-        edgeHead.push_back(0);
-        edgeX.push_back(0);
-
-        for (int i = 0; i < n; ++i)
+        for (int t = 0; t < T; ++t)
         {
-            for (int j = i + 1; j < n; ++j)
+            if (mSupport.getNbEdges(k, t) == 0) continue;
+
+            const auto& sep = mCapSeparators[k * T + t];
+            const auto& cuts = sep.getCuts();
+            const int nbAddedBefore = nbAdded;
+            for (std::size_t c = 0; c < cuts.size(); ++c)
             {
-                if (xVal[i][j][k][t] > utils::GRB_EPSILON)
+                const auto nodes = cuts.getNodes(c);
+
+                /* keep it for the next separations of (k, t) */
+                mCutPool.addCap(k,
+                                t,
+                                static_cast<int>(nodes.size()),
+                                cuts.getIntList(c),
+                                cuts.getRHS(c));
+
+                list.clear();
+                for (auto i : nodes)
                 {
-                    edgeTail.push_back(i == 0 ? n : i);
-                    edgeHead.push_back(j);
-                    edgeX.push_back(xVal[i][j][k][t]);
+                    list.push_back(checkForDepot(i, n));
+                }
+
+                if (mPropagateSep)
+                {
+                    addFoundSet(sets, list, k * T + t, nbGraphs);
+                }
+
+                GRBLinExpr xExpr = 0, yExpr = 0;
+                double xSum = 0, ySum = 0;
+                for (std::size_t i = 0; i < list.size(); ++i)
+                {
+                    for (std::size_t j = 0; j < list.size(); ++j)
+                    {
+                        if (list[i] < list[j])
+                        {
+                            const int e = mIdx.x(list[i], list[j], k, t);
+                            xExpr += mVars[e];
+                            xSum += mVals[e];
+                        }
+                    }
+                    yExpr += mVars[mIdx.y(list[i], k, t)];
+                    ySum += mVals[mIdx.y(list[i], k, t)];
+                }
+
+                for (std::size_t i = 0; i < list.size(); ++i)
+                {
+                    const int yi = mIdx.y(list[i], k, t);
+                    if (cstType == constrsType::lazy)
+                    {
+                        addLazy(xExpr <= yExpr - mVars[yi]);
+                        ++nbAdded;
+                    }
+                    else if (xSum - ySum + mVals[yi] > utils::GRB_EPSILON)
+                    {
+                        addCut(xExpr <= yExpr - mVars[yi]);
+                        ++nbAdded;
+                    }
                 }
             }
+
+            mStats.addCuts(k, t, cuts.size(), nbAdded - nbAddedBefore);
+            mStats.addFamily("cap", cuts.size(), nbAdded - nbAddedBefore);
+            mStats.addViolation(sep.getMaxViolation());
+            maxViolation = std::max(maxViolation, sep.getMaxViolation());
         }
     }
 
-    return std::make_tuple(nbEdges, edgeTail, edgeHead, edgeX);
-}
+    if (mPropagateSep)
+    {
+        nbAdded += propagateCuts(cstType, sets, false);
+    }
 
+    return nbAdded;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-
-
-int CallbackSEC::addCVRPSEPCAP(const constrsType cstType)
+int CallbackSEC::addCVRPSEPCAPAggregated(const constrsType cstType,
+                                         double& maxViolation)
 {
     int nbAdded = 0; // # of lazy/cuts added in this call
+    maxViolation = 0;
 
-    /* get solution: delivery quantities */
-    auto qVal = getqVarsValues(cstType);
-    /* get solution: routing */
-    auto xVal = getxVarsValues(cstType);
-    /* get solution: visitation */
-    auto yVal = getyVarsValues(cstType);
+    /* get solution: delivery quantities, routing and visitation */
+    getVarsValues(cstType);
+    mAggSupport.build(mVals, utils::GRB_EPSILON);
 
     const int n = mpInst->getNbVertices();
-    for (int k = 0; k < mpInst->getK(); ++k)
+    const int K = mpInst->getK();
+    const int T = mpInst->getT();
+
+    /* Separation of each period support graph (x and q summed over the
+       vehicles, K vehicles of capacity C_k). Task t only uses
+       mAggCapSeparators[t]. */
+    auto separate = [&](const int t)
+    {
+        const int nbEdges = mAggSupport.getNbEdges(0, t);
+
+        if (nbEdges == 0) return;
+
+        /* the vehicles are identical: C_k = round(C / K) for every k */
+        mAggCapSeparators[t].separate(
+            n - 1,
+            mpInst->getCk(0),
+            utils::Span<const int>(mAggSupport.getDemand(0, t) + 1, n - 1),
+            utils::Span<const int>(mAggSupport.getEdgeTail(0, t), nbEdges),
+            utils::Span<const int>(mAggSupport.getEdgeHead(0, t), nbEdges),
+            utils::Span<const double>(mAggSupport.getEdgeX(0, t), nbEdges),
+            mAggCutPool.getCMP(0, t));
+    };
+
+    if (mpSepPool)
     {
-        for (int t = 0; t < mpInst->getT(); ++t)
+        mpSepPool->parallelFor(T, separate);
+    }
+    else
+    {
+        for (int t = 0; t < T; ++t)
+        {
+            separate(t);
+        }
+    }
+
+    /* Each set S is translated into the sum over the vehicles of the subtour
+       elimination constraints of S:
+       sum_k x_k(E(S)) <= sum_k (y_k(S) - y_km), for every m in S. */
+    foundSets sets;
+    std::vector<int> list; // set of the current cut (reused)
+    for (int t = 0; t < T; ++t)
+    {
+        if (mAggSupport.getNbEdges(0, t) == 0) continue;
+
+        const auto& sep = mAggCapSeparators[t];
+        const auto& cuts = sep.getCuts();
+        const int nbAddedBefore = nbAdded;
+        for (std::size_t c = 0; c < cuts.size(); ++c)
         {
-            auto [nbEdges, edgeTail, edgeHead, edgeX] = getEdges(xVal, n, k, t);
-
-            if (nbEdges == 0) continue;
-
-            /* Parameters of the CVRPSEP */
-            char integerAndFeasible;
-            double maxViolation = 0;
-            auto demand = getDemand(qVal, k, t);
-            CnstrMgrPointer cutsCMP, myOldCutsCMP;
-            CMGR_CreateCMgr(&cutsCMP, cDim);
-            CMGR_CreateCMgr(&myOldCutsCMP, cDim);
-
-            CAPSEP_SeparateCapCuts(n - 1,
-                                   demand.data(),
-                                   mpInst->getCk(k),
-                                   nbEdges,
-                                   edgeTail.data(),
-                                   edgeHead.data(),
-                                   edgeX.data(),
-                                   myOldCutsCMP,
-                                   cMaxNbCapCuts,
-                                   utils::GRB_EPSILON,
-                                   &integerAndFeasible,
-                                   &maxViolation,
-                                   cutsCMP);
-
-            for (int c = 0; c < cutsCMP->Size; ++c)
+            const auto nodes = cuts.getNodes(c);
+
+            /* keep it for the next separations of t */
+            mAggCutPool.addCap(0,
+                               t,
+                               static_cast<int>(nodes.size()),
+                               cuts.getIntList(c),
+                               cuts.getRHS(c));
+
+            list.clear();
+            for (auto i : nodes)
             {
-                if (cutsCMP->CPL[c]->CType == CMGR_CT_CAP)
-                {
-                    std::vector<int> list;
-                    list.reserve(cutsCMP->CPL[c]->IntListSize);
-                    for (int j = 1; j <= cutsCMP->CPL[c]->IntListSize; ++j)
-                    {
-                        list.push_back(
-                            checkForDepot(cutsCMP->CPL[c]->IntList[j], n));
-                    }
+                list.push_back(checkForDepot(i, n));
+            }
 
-                    GRBLinExpr xExpr = 0, yExpr = 0;
-                    double xSum = 0, ySum = 0;
-                    for (std::size_t i = 0; i < list.size(); ++i)
-                    {
-                        for (std::size_t j = 0; j < list.size(); ++j)
-                        {
-                            if (list[i] < list[j])
-                            {
-                                xExpr += m_x[list[i]][list[j]][k][t];
-                                xSum += xVal[list[i]][list[j]][k][t];
-                            }
-                        }
-                        yExpr += m_y[list[i]][k][t];
-                        ySum += yVal[list[i]][k][t];
-                    }
+            if (mPropagateSep)
+            {
+                addFoundSet(sets, list, t, T);
+            }
 
-                    for (std::size_t i = 0; i < list.size(); ++i)
+            GRBLinExpr xExpr = 0, yExpr = 0;
+            double xSum = 0, ySum = 0;
+            for (int k = 0; k < K; ++k)
+            {
+                for (std::size_t i = 0; i < list.size(); ++i)
+                {
+                    for (std::size_t j = 0; j < list.size(); ++j)
                     {
-                        if (cstType == constrsType::lazy)
-                        {
-                            addLazy(xExpr <= yExpr - m_y[list[i]][k][t]);
-                            ++nbAdded;
-                        }
-                        else if (xSum - ySum + yVal[list[i]][k][t] >
-                                 utils::GRB_EPSILON)
+                        if (list[i] < list[j])
                         {
-                            addCut(xExpr <= yExpr - m_y[list[i]][k][t]);
-                            ++nbAdded;
+                            const int e = mIdx.x(list[i], list[j], k, t);
+                            xExpr += mVars[e];
+                            xSum += mVals[e];
                         }
                     }
+                    yExpr += mVars[mIdx.y(list[i], k, t)];
+                    ySum += mVals[mIdx.y(list[i], k, t)];
                 }
             }
 
-            CMGR_FreeMemCMgr(&cutsCMP);
-            CMGR_FreeMemCMgr(&myOldCutsCMP);
+            for (std::size_t i = 0; i < list.size(); ++i)
+            {
+                GRBLinExpr ymExpr = 0;
+                double ymSum = 0;
+                for (int k = 0; k < K; ++k)
+                {
+                    ymExpr += mVars[mIdx.y(list[i], k, t)];
+                    ymSum += mVals[mIdx.y(list[i], k, t)];
+                }
+
+                if (cstType == constrsType::lazy)
+                {
+                    addLazy(xExpr <= yExpr - ymExpr);
+                    ++nbAdded;
+                }
+                else if (xSum - ySum + ymSum > utils::GRB_EPSILON)
+                {
+                    addCut(xExpr <= yExpr - ymExpr);
+                    ++nbAdded;
+                }
+            }
         }
+
+        /* aggregated cuts are counted as vehicle 0 */
+        mStats.addCuts(0, t, cuts.size(), nbAdded - nbAddedBefore);
+        mStats.addFamily("cap", cuts.size(), nbAdded - nbAddedBefore);
+        mStats.addViolation(sep.getMaxViolation());
+        maxViolation = std::max(maxViolation, sep.getMaxViolation());
+    }
+
+    if (mPropagateSep)
+    {
+        nbAdded += propagateCuts(cstType, sets, true);
     }
 
     return nbAdded;
-}
\ No newline at end of file
+}
@@ -0,0 +1,206 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: exact_sec.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Exact separation of the subtour elimination cuts of fractional
+ * (MIPNODE) solutions with Gomory-Hu cut trees (CVRPSEP max flow package).
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 06:30 PM
+ *
+ * References:
+ * [1] D. Gusfield. Very simple methods for all pairs network flow analysis.
+ * SIAM Journal on Computing, 19(1), 143-155, 1990.
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../../include/ext/cvrpsep/memmod.h"
+#include "../../../include/ext/cvrpsep/mxf.h"
+#include "../../../include/ext/loguru/loguru.hpp"
+
+#include "../../../include/callback/callback_sec.hpp"
+#include "../../../include/utils/constants.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+// the max flow package works with integer capacities: x_e * cFlowScale
+static const double cFlowScale = 1e4;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CallbackSEC::addExactSEC(const constrsType cstType, double& maxViolation)
+{
+    int nbAdded = 0; // # of lazy/cuts added in this call
+    maxViolation = 0;
+
+    getVarsValues(cstType);
+    mSupport.build(mVals, utils::GRB_EPSILON);
+
+    const int n = mpInst->getNbVertices(); // depot is n in the support graphs
+    const int T = mpInst->getT();
+    const int nbGraphs = mpInst->getK() * T;
+
+    /* Task kt builds the cut tree of the (k, t) support graph rooted at the
+       depot and only writes setsFound[kt]. With the degree constraints,
+       x(E(S)) <= y(S) - y_m is equivalent to x(delta(S)) >= 2 y_m, so the
+       most violated cut of customer m is given by the minimum cut separating
+       m from the depot, i.e., the lightest tree edge on the path m-depot. */
+    std::vector<std::vector<std::vector<int>>> setsFound(nbGraphs);
+    auto separate = [&](const int kt)
+    {
+        const int k = kt / T;
+        const int t = kt % T;
+
+        const int nbEdges = mSupport.getNbEdges(k, t);
+        if (nbEdges == 0) return;
+
+        const int* edgeTail = mSupport.getEdgeTail(k, t);
+        const int* edgeHead = mSupport.getEdgeHead(k, t);
+        const double* edgeX = mSupport.getEdgeX(k, t);
+
+        MaxFlowPtr mxf;
+        MemArenaBegin();
+        MXF_InitMem(&mxf, n, 2 * nbEdges);
+        MXF_ClearNodeList(mxf);
+        MXF_SetNodeListSize(mxf, n);
+        MXF_ClearArcList(mxf);
+        for (int e = 0; e < nbEdges; ++e)
+        {
+            const int cap = static_cast<int>(std::lround(edgeX[e] *
+                                                         cFlowScale));
+            MXF_AddArc(mxf, edgeTail[e], edgeHead[e], cap);
+            MXF_AddArc(mxf, edgeHead[e], edgeTail[e], cap);
+        }
+        MXF_CreateMates(mxf);
+
+        /* tree edge (i, nextOnPath[i]) of weight cutValue[i], arrays 1..n */
+        std::vector<int> cutValue(n + 1, 0), nextOnPath(n + 1, 0);
+        MXF_ComputeGHCutTree(mxf, n, cutValue.data(), nextOnPath.data());
+        MXF_FreeMem(mxf);
+        MemArenaEnd();
+
+        /* the node below the lightest edge on the path of each customer to
+           the depot: its subtree is the set of the cut */
+        std::vector<char> isRoot(n + 1, 0);
+        for (int m = 1; m < n; ++m)
+        {
+            const double ym = mVals[mIdx.y(m, k, t)];
+            if (ym <= utils::GRB_EPSILON) continue;
+
+            int minNode = m;
+            for (int i = nextOnPath[m]; i != n; i = nextOnPath[i])
+            {
+                if (cutValue[i] < cutValue[minNode]) minNode = i;
+            }
+
+            if (ym - cutValue[minNode] / (2 * cFlowScale) >
+                utils::GRB_EPSILON)
+            {
+                isRoot[minNode] = 1;
+            }
+        }
+
+        /* children lists of the tree (first/next), then the subtrees */
+        std::vector<int> firstChild(n + 1, 0), nextSibling(n + 1, 0);
+        for (int i = 1; i < n; ++i)
+        {
+            nextSibling[i] = firstChild[nextOnPath[i]];
+            firstChild[nextOnPath[i]] = i;
+        }
+
+        std::vector<int> stack;
+        for (int r = 1; r < n; ++r)
+        {
+            if (!isRoot[r]) continue;
+
+            std::vector<int> list;
+            stack.assign(1, r);
+            while (!stack.empty())
+            {
+                const int i = stack.back();
+                stack.pop_back();
+                list.push_back(i);
+                for (int c = firstChild[i]; c != 0; c = nextSibling[c])
+                {
+                    stack.push_back(c);
+                }
+            }
+            std::sort(list.begin(), list.end());
+            setsFound[kt].push_back(std::move(list));
+        }
+    };
+
+    if (mpSepPool)
+    {
+        mpSepPool->parallelFor(nbGraphs, separate);
+    }
+    else
+    {
+        for (int kt = 0; kt < nbGraphs; ++kt)
+        {
+            separate(kt);
+        }
+    }
+
+    /* cuts added in (k, t) order, as in addCVRPSEPCAP() */
+    for (int k = 0; k < mpInst->getK(); ++k)
+    {
+        for (int t = 0; t < T; ++t)
+        {
+            const auto& sets = setsFound[k * T + t];
+            const int nbAddedBefore = nbAdded;
+            for (const auto& list : sets)
+            {
+                GRBLinExpr xExpr = 0, yExpr = 0;
+                double xSum = 0, ySum = 0;
+                for (std::size_t i = 0; i < list.size(); ++i)
+                {
+                    for (std::size_t j = i + 1; j < list.size(); ++j)
+                    {
+                        const int e = mIdx.x(list[i], list[j], k, t);
+                        xExpr += mVars[e];
+                        xSum += mVals[e];
+                    }
+                    yExpr += mVars[mIdx.y(list[i], k, t)];
+                    ySum += mVals[mIdx.y(list[i], k, t)];
+                }
+
+                for (auto m : list)
+                {
+                    const int ym = mIdx.y(m, k, t);
+                    const double violation = xSum - ySum + mVals[ym];
+                    if (violation <= utils::GRB_EPSILON) continue;
+
+                    if (cstType == constrsType::lazy)
+                    {
+                        addLazy(xExpr <= yExpr - mVars[ym]);
+                    }
+                    else
+                    {
+                        addCut(xExpr <= yExpr - mVars[ym]);
+                    }
+                    ++nbAdded;
+                    maxViolation = std::max(maxViolation, violation);
+                }
+            }
+
+            mStats.addCuts(k, t, sets.size(), nbAdded - nbAddedBefore);
+            mStats.addFamily("exact", sets.size(), nbAdded - nbAddedBefore);
+        }
+    }
+
+    mStats.addViolation(maxViolation);
+    mStats.addExact(nbAdded);
+
+    return nbAdded;
+}
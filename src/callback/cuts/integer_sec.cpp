@@ -0,0 +1,225 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: integer_sec.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Lazy subtour elimination constraints for integer solutions (MIPSOL)
+ * found with union-find, without the CVRPSEP package.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 03:20 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <utility>
+
+#include "../../../include/ext/loguru/loguru.hpp"
+
+#include "../../../include/callback/callback_sec.hpp"
+#include "../../../include/utils/constants.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+/**
+ * @brief Disjoint sets over the vertices 1..n (union by size, path halving).
+*/
+class DisjointSets
+{
+public:
+
+    explicit DisjointSets(const int n) : mParent(n + 1), mSize(n + 1) {}
+
+    void reset()
+    {
+        for (std::size_t i = 0; i < mParent.size(); ++i)
+        {
+            mParent[i] = static_cast<int>(i);
+            mSize[i] = 1;
+        }
+    }
+
+    int find(int i)
+    {
+        while (mParent[i] != i)
+        {
+            mParent[i] = mParent[mParent[i]];
+            i = mParent[i];
+        }
+        return i;
+    }
+
+    void unite(int i, int j)
+    {
+        i = find(i);
+        j = find(j);
+        if (i == j) return;
+        if (mSize[i] < mSize[j]) std::swap(i, j);
+        mParent[j] = i;
+        mSize[i] += mSize[j];
+    }
+
+    int getSize(const int root) const
+    {
+        return mSize[root];
+    }
+
+private:
+
+    std::vector<int> mParent;
+    std::vector<int> mSize;
+};
+
+/**
+ * @brief Minimum number of vehicles needed to serve a demand (CVRPSEP
+ * convention: at least one).
+*/
+int minNbVehicles(const int demand, const int cap)
+{
+    int nb = 1;
+    for (int capSum = cap; capSum < demand; capSum += cap)
+    {
+        ++nb;
+    }
+    return nb;
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CallbackSEC::addIntegerSEC()
+{
+    int nbAdded = 0; // # of lazy constraints added in this call
+
+    /* get solution: delivery quantities, routing and visitation */
+    getVarsValues(constrsType::lazy);
+    mSupport.build(mVals, utils::GRB_EPSILON);
+
+    /* CVRPSEP numbering: customers 1..n-1 and depot n */
+    const int n = mpInst->getNbVertices();
+
+    DisjointSets sets(n);
+    std::vector<char> toDepot(n + 1);
+    std::vector<int> load(n + 1);
+    // members of the components, grouped by root (increasing order)
+    std::vector<int> first(n + 2);
+    std::vector<int> next(n + 1);
+    std::vector<int> members(n);
+    // CVRPSEP node list of a cut (1-based)
+    std::vector<int> intList;
+    intList.reserve(n);
+
+    for (int k = 0; k < mpInst->getK(); ++k)
+    {
+        for (int t = 0; t < mpInst->getT(); ++t)
+        {
+            const int nbEdges = mSupport.getNbEdges(k, t);
+
+            if (nbEdges == 0) continue;
+
+            std::size_t nbFound = 0;
+            const int nbAddedBefore = nbAdded;
+            const int* edgeTail = mSupport.getEdgeTail(k, t);
+            const int* edgeHead = mSupport.getEdgeHead(k, t);
+            const int* demand = mSupport.getDemand(k, t);
+
+            /* components of the customers (the depot is left out, as in
+               COMPCUTS_ComputeCompCuts) */
+            sets.reset();
+            for (int e = 0; e < nbEdges; ++e)
+            {
+                if (edgeTail[e] != n)
+                {
+                    sets.unite(edgeTail[e], edgeHead[e]);
+                }
+            }
+
+            std::fill(toDepot.begin(), toDepot.end(), 0);
+            std::fill(load.begin(), load.end(), 0);
+            for (int e = 0; e < nbEdges; ++e)
+            {
+                if (edgeTail[e] == n)
+                {
+                    toDepot[sets.find(edgeHead[e])] = 1;
+                }
+            }
+
+            std::fill(first.begin(), first.end(), 0);
+            for (int i = 1; i < n; ++i)
+            {
+                const int r = sets.find(i);
+                load[r] += demand[i];
+                ++first[r + 1];
+            }
+            for (int r = 1; r <= n; ++r)
+            {
+                first[r + 1] += first[r];
+            }
+            std::copy(first.begin(), first.end() - 1, next.begin());
+            for (int i = 1; i < n; ++i)
+            {
+                members[next[sets.find(i)]++] = i;
+            }
+
+            for (int r = 1; r < n; ++r)
+            {
+                /* A route through the depot is not a violation: its load is
+                   bounded by the vehicle capacity constraints of the model
+                   (q(S) <= C_k y_0kt), so only the subtours (components
+                   with edges not connected to the depot) are cut off. */
+                if (sets.find(r) != r || sets.getSize(r) < 2 || toDepot[r])
+                {
+                    continue;
+                }
+
+                const int size = sets.getSize(r);
+                const int* list = members.data() + first[r];
+                const int minV = minNbVehicles(load[r], mpInst->getCk(k));
+                ++nbFound;
+
+                /* keep it for the fractional separation of (k, t) (1-based
+                   list, as the CVRPSEP constraint manager expects) */
+                intList.assign(1, 0);
+                intList.insert(intList.end(), list, list + size);
+                mCutPool.addCap(k,
+                                t,
+                                size,
+                                intList.data(),
+                                size - minV);
+
+                GRBLinExpr xExpr = 0, yExpr = 0;
+                double xSum = 0;
+                for (int i = 0; i < size; ++i)
+                {
+                    for (int j = i + 1; j < size; ++j)
+                    {
+                        const int e = mIdx.x(list[i], list[j], k, t);
+                        xExpr += mVars[e];
+                        xSum += mVals[e];
+                    }
+                    yExpr += mVars[mIdx.y(list[i], k, t)];
+                }
+
+                /* violation of the capacity cut x(S) <= |S| - minV */
+                mStats.addViolation(xSum - (size - minV));
+
+                for (int i = 0; i < size; ++i)
+                {
+                    addLazy(xExpr <= yExpr - mVars[mIdx.y(list[i], k, t)]);
+                    ++nbAdded;
+                }
+            }
+
+            mStats.addCuts(k, t, nbFound, nbAdded - nbAddedBefore);
+        }
+    }
+
+    return nbAdded;
+}
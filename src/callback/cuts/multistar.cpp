@@ -0,0 +1,295 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: multistar.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Multistar cuts of the (vehicle, period) support graphs, written
+ * with the delivered quantities (q) of the IRP model.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 07:20 PM
+ *
+ * References:
+ * [1] L. Gouveia. A result on projection for the vehicle routing problem.
+ * European Journal of Operational Research, 85(3), 610-624, 1995.
+ * [2] A. N. Letchford, R. W. Eglese and J. Lysgaard. Multistars, partial
+ * multistars and the capacitated vehicle routing problem. Mathematical
+ * Programming, 94(1), 21-40, 2002.
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <set>
+#include <utility>
+
+#include "../../../include/ext/loguru/loguru.hpp"
+
+#include "../../../include/callback/callback_sec.hpp"
+#include "../../../include/utils/constants.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+// maximum number of multistar cuts of one (k, t) support graph per round
+static const int cMaxNbMstarCuts = 8;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+/* For the route of vehicle k in period t and a customer set S:
+
+     q(S) + sum_{(i, j) in P} q_j x_ij <= (C_k / 2) x(delta(S)),
+
+   P being any set of pairs i in S, j a customer not in S (each vehicle is a
+   single route: a customer j adjacent to S twice makes the route cross S
+   two more times). Since q_j is a variable, q_j x_ij is replaced by its
+   lower bound q_j + B_j x_ij - B_j, B_j = min(C_k, U_j) >= q_j, and P only
+   holds the pairs where this bound is positive at the current point. */
+int CallbackSEC::addMultistarCuts(const constrsType cstType,
+                                  double& maxViolation)
+{
+    int nbAdded = 0; // # of lazy/cuts added in this call
+    maxViolation = 0;
+
+    mSupport.build(mVals, utils::GRB_EPSILON);
+
+    const int n = mpInst->getNbVertices(); // depot is n in the support graphs
+    const int T = mpInst->getT();
+    const int nbGraphs = mpInst->getK() * T;
+
+    /* Greedy search from each customer with a positive delivery: the
+       neighbour of S that most increases the violation is added while the
+       violation increases. Task kt only writes setsFound[kt]. */
+    std::vector<std::vector<std::vector<int>>> setsFound(nbGraphs);
+    auto separate = [&](const int kt)
+    {
+        const int k = kt / T;
+        const int t = kt % T;
+
+        const int nbEdges = mSupport.getNbEdges(k, t);
+        if (nbEdges == 0) return;
+
+        const int* edgeTail = mSupport.getEdgeTail(k, t);
+        const int* edgeHead = mSupport.getEdgeHead(k, t);
+        const double* edgeX = mSupport.getEdgeX(k, t);
+        const double halfC = mpInst->getCk(k) / 2;
+
+        /* adjacency lists (CSR) of the support graph */
+        std::vector<int> first(n + 2, 0);
+        for (int e = 0; e < nbEdges; ++e)
+        {
+            ++first[edgeTail[e] + 1];
+            ++first[edgeHead[e] + 1];
+        }
+        for (int i = 1; i <= n + 1; ++i)
+        {
+            first[i] += first[i - 1];
+        }
+        std::vector<int> adjNode(2 * nbEdges);
+        std::vector<double> adjX(2 * nbEdges);
+        std::vector<int> pos(first.begin(), first.end() - 1);
+        for (int e = 0; e < nbEdges; ++e)
+        {
+            adjNode[pos[edgeTail[e]]] = edgeHead[e];
+            adjX[pos[edgeTail[e]]++] = edgeX[e];
+            adjNode[pos[edgeHead[e]]] = edgeTail[e];
+            adjX[pos[edgeHead[e]]++] = edgeX[e];
+        }
+
+        std::vector<double> qv(n, 0), bound(n, 0);
+        for (int i = 1; i < n; ++i)
+        {
+            qv[i] = mVals[mIdx.q(i, k, t)];
+            bound[i] = std::min(mpInst->getCk(k), mpInst->getUi(i));
+        }
+
+        /* star term of the pair (i in S, j not in S) */
+        auto star = [&](const int j, const double x)
+        {
+            return j == n ? 0 : std::max(0.0, qv[j] + bound[j] * (x - 1));
+        };
+
+        /* violation increase of S + {j} */
+        std::vector<char> inS(n + 1, 0);
+        auto gain = [&](const int j)
+        {
+            double g = qv[j];
+            for (int a = first[j]; a < first[j + 1]; ++a)
+            {
+                const int l = adjNode[a];
+                if (inS[l])
+                {
+                    g += halfC * adjX[a] - star(j, adjX[a]);
+                }
+                else
+                {
+                    g += star(l, adjX[a]) - halfC * adjX[a];
+                }
+            }
+            return g;
+        };
+
+        std::vector<std::pair<double, std::vector<int>>> cuts;
+        std::set<std::vector<int>> seen;
+        std::vector<int> stamp(n + 1, 0);
+        int curStamp = 0;
+        for (int m = 1; m < n; ++m)
+        {
+            if (qv[m] <= utils::GRB_EPSILON) continue;
+
+            std::vector<int> list(1, m);
+            double violation = gain(m);
+            inS[m] = 1;
+
+            while (true)
+            {
+                int bestNode = 0;
+                double bestGain = utils::GRB_EPSILON;
+                ++curStamp;
+                for (auto i : list)
+                {
+                    for (int a = first[i]; a < first[i + 1]; ++a)
+                    {
+                        const int j = adjNode[a];
+                        if (j == n || inS[j] || stamp[j] == curStamp)
+                        {
+                            continue;
+                        }
+                        stamp[j] = curStamp;
+                        const double g = gain(j);
+                        if (g > bestGain)
+                        {
+                            bestGain = g;
+                            bestNode = j;
+                        }
+                    }
+                }
+
+                if (bestNode == 0) break;
+
+                inS[bestNode] = 1;
+                list.push_back(bestNode);
+                violation += bestGain;
+            }
+
+            for (auto i : list)
+            {
+                inS[i] = 0;
+            }
+
+            if (violation <= utils::GRB_EPSILON) continue;
+
+            std::sort(list.begin(), list.end());
+            if (seen.insert(list).second)
+            {
+                cuts.emplace_back(violation, std::move(list));
+            }
+        }
+
+        /* the most violated ones */
+        std::sort(cuts.begin(), cuts.end(), [](const auto& a, const auto& b)
+            { return a.first > b.first; });
+        if (static_cast<int>(cuts.size()) > cMaxNbMstarCuts)
+        {
+            cuts.resize(cMaxNbMstarCuts);
+        }
+        for (auto& c : cuts)
+        {
+            setsFound[kt].push_back(std::move(c.second));
+        }
+    };
+
+    if (mpSepPool)
+    {
+        mpSepPool->parallelFor(nbGraphs, separate);
+    }
+    else
+    {
+        for (int kt = 0; kt < nbGraphs; ++kt)
+        {
+            separate(kt);
+        }
+    }
+
+    /* cuts added in (k, t) order, as in addCVRPSEPCAP() */
+    std::vector<char> inS(n, 0);
+    for (int k = 0; k < mpInst->getK(); ++k)
+    {
+        for (int t = 0; t < T; ++t)
+        {
+            const auto& sets = setsFound[k * T + t];
+            const double halfC = mpInst->getCk(k) / 2;
+            const int nbAddedBefore = nbAdded;
+            for (const auto& list : sets)
+            {
+                for (auto i : list)
+                {
+                    inS[i] = 1;
+                }
+
+                /* q(S) - (C_k / 2) x(delta(S)) + star terms <= sum_P B_j */
+                GRBLinExpr expr = 0;
+                double lhs = 0, rhs = 0;
+                for (auto i : list)
+                {
+                    expr += mVars[mIdx.q(i, k, t)];
+                    lhs += mVals[mIdx.q(i, k, t)];
+                    for (int j = 0; j < n; ++j)
+                    {
+                        if (j > 0 && inS[j]) continue;
+
+                        const int e = j < i ? mIdx.x(j, i, k, t) :
+                                              mIdx.x(i, j, k, t);
+                        expr -= halfC * mVars[e];
+                        lhs -= halfC * mVals[e];
+
+                        if (j == 0) continue;
+
+                        const double bj = std::min(mpInst->getCk(k),
+                                                   mpInst->getUi(j));
+                        const int qj = mIdx.q(j, k, t);
+                        if (mVals[qj] + bj * (mVals[e] - 1) >
+                            utils::GRB_EPSILON)
+                        {
+                            expr += mVars[qj] + bj * mVars[e];
+                            lhs += mVals[qj] + bj * mVals[e];
+                            rhs += bj;
+                        }
+                    }
+                }
+
+                for (auto i : list)
+                {
+                    inS[i] = 0;
+                }
+
+                const double violation = lhs - rhs;
+                if (cstType == constrsType::lazy)
+                {
+                    addLazy(expr <= rhs);
+                }
+                else if (violation > utils::GRB_EPSILON)
+                {
+                    addCut(expr <= rhs);
+                }
+                else
+                {
+                    continue;
+                }
+                ++nbAdded;
+                maxViolation = std::max(maxViolation, violation);
+            }
+
+            mStats.addCuts(k, t, sets.size(), nbAdded - nbAddedBefore);
+            mStats.addFamily("mstar", sets.size(), nbAdded - nbAddedBefore);
+        }
+    }
+
+    mStats.addViolation(maxViolation);
+
+    return nbAdded;
+}
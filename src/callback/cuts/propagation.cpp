@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: propagation.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Propagation of the customer sets found by the separation of one
+ * (vehicle, period) support graph to the other ones.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 05:45 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "../../../include/ext/loguru/loguru.hpp"
+
+#include "../../../include/callback/callback_sec.hpp"
+#include "../../../include/utils/constants.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CallbackSEC::propagateCuts(const constrsType cstType,
+                               const foundSets& sets,
+                               const bool aggregated)
+{
+    int nbAdded = 0; // # of lazy/cuts added in this call
+
+    const int n = mpInst->getNbVertices();
+    const int K = mpInst->getK();
+    const int T = mpInst->getT();
+    const int nbGraphs = aggregated ? T : K * T;
+    SupportGraph& support = aggregated ? mAggSupport : mSupport;
+
+    // membership of the current set (CVRPSEP numbering, depot n never in)
+    std::vector<char> inS(n + 1, 0);
+
+    for (const auto& [list, foundIn] : sets)
+    {
+        DCHECK_F(static_cast<int>(foundIn.size()) == nbGraphs);
+        for (auto i : list)
+        {
+            inS[i] = 1;
+        }
+
+        for (int g = 0; g < nbGraphs; ++g)
+        {
+            /* already separated there */
+            if (foundIn[g]) continue;
+
+            const int t = g % T;
+            const int kGraph = aggregated ? 0 : g / T;
+            // vehicles whose variables are in the graph
+            const int kBegin = kGraph;
+            const int kEnd = aggregated ? K : kGraph + 1;
+
+            /* x(E(S)) from the sparse support graph of g */
+            const int nbEdges = support.getNbEdges(kGraph, t);
+            const int* edgeTail = support.getEdgeTail(kGraph, t);
+            const int* edgeHead = support.getEdgeHead(kGraph, t);
+            const double* edgeX = support.getEdgeX(kGraph, t);
+            double xSum = 0;
+            for (int e = 0; e < nbEdges; ++e)
+            {
+                if (inS[edgeTail[e]] && inS[edgeHead[e]])
+                {
+                    xSum += edgeX[e];
+                }
+            }
+
+            double ySum = 0, yMax = 0;
+            for (auto i : list)
+            {
+                double yi = 0;
+                for (int k = kBegin; k < kEnd; ++k)
+                {
+                    yi += mVals[mIdx.y(i, k, t)];
+                }
+                ySum += yi;
+                yMax = std::max(yMax, yi);
+            }
+
+            /* the most violated constraint is the one of the largest y_m */
+            if (xSum - ySum + yMax <= utils::GRB_EPSILON) continue;
+
+            GRBLinExpr xExpr = 0, yExpr = 0;
+            for (int k = kBegin; k < kEnd; ++k)
+            {
+                for (std::size_t i = 0; i < list.size(); ++i)
+                {
+                    for (std::size_t j = i + 1; j < list.size(); ++j)
+                    {
+                        xExpr += mVars[mIdx.x(list[i], list[j], k, t)];
+                    }
+                    yExpr += mVars[mIdx.y(list[i], k, t)];
+                }
+            }
+
+            int nbAddedGraph = 0;
+            for (auto m : list)
+            {
+                GRBLinExpr ymExpr = 0;
+                double ym = 0;
+                for (int k = kBegin; k < kEnd; ++k)
+                {
+                    ymExpr += mVars[mIdx.y(m, k, t)];
+                    ym += mVals[mIdx.y(m, k, t)];
+                }
+
+                if (xSum - ySum + ym <= utils::GRB_EPSILON) continue;
+
+                if (cstType == constrsType::lazy)
+                {
+                    addLazy(xExpr <= yExpr - ymExpr);
+                }
+                else
+                {
+                    addCut(xExpr <= yExpr - ymExpr);
+                }
+                ++nbAddedGraph;
+            }
+
+            mStats.addCuts(kGraph, t, 0, nbAddedGraph);
+            mStats.addPropagated(nbAddedGraph);
+            nbAdded += nbAddedGraph;
+        }
+
+        for (auto i : list)
+        {
+            inS[i] = 0;
+        }
+    }
+
+    return nbAdded;
+}
@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: q_capacity.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Capacity cuts of the (vehicle, period) support graphs separated on
+ * the (real valued) delivered quantities, by a max flow.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 09:10 PM
+ *
+ * References:
+ * [1] L. C. Coelho and G. Laporte. The exact solution of several classes of
+ * inventory-routing problems. Computers & Operations Research, 40(2), 2013,
+ * pp. 558-565.
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../../include/ext/cvrpsep/memmod.h"
+#include "../../../include/ext/cvrpsep/mxf.h"
+#include "../../../include/ext/loguru/loguru.hpp"
+
+#include "../../../include/callback/callback_sec.hpp"
+#include "../../../include/utils/constants.hpp"
+
+////////////////////////////// Helper functions  ///////////////////////////////
+
+namespace
+{
+
+// the max flow package works with integer capacities: value * cFlowScale
+static const double cFlowScale = 1e4;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+/* For the route of vehicle k in period t and a customer set S, the load
+   entering S is at most C_k per crossing: (C_k / 2) x(delta(S)) >= q(S), i.e.,
+   with the degree constraints, x(E(S)) <= y(S) - q(S) / C_k.
+
+   min_S x(delta(S)) - (2 / C_k) q(S) is a minimum cut: source = depot, an
+   extra sink z and arcs i -> z of capacity w_i = 2 q_i / C_k. A cut with
+   sink side S + {z} costs x(delta(S)) + w(N \ S) = x(delta(S)) - w(S) + w(N),
+   so S is violated iff the cut is smaller than w(N). */
+int CallbackSEC::addQCapacityCuts(const constrsType cstType,
+                                  double& maxViolation)
+{
+    int nbAdded = 0; // # of lazy/cuts added in this call
+    maxViolation = 0;
+
+    mSupport.build(mVals, utils::GRB_EPSILON);
+
+    const int n = mpInst->getNbVertices(); // depot is n in the support graphs
+    const int T = mpInst->getT();
+    const int nbGraphs = mpInst->getK() * T;
+
+    /* task kt only writes setsFound[kt] (at most one set per graph) */
+    std::vector<std::vector<int>> setsFound(nbGraphs);
+    auto separate = [&](const int kt)
+    {
+        const int k = kt / T;
+        const int t = kt % T;
+
+        const int nbEdges = mSupport.getNbEdges(k, t);
+        if (nbEdges == 0) return;
+
+        const int* edgeTail = mSupport.getEdgeTail(k, t);
+        const int* edgeHead = mSupport.getEdgeHead(k, t);
+        const double* edgeX = mSupport.getEdgeX(k, t);
+        const int sink = n + 1;
+
+        MaxFlowPtr mxf;
+        MemArenaBegin();
+        MXF_InitMem(&mxf, n + 1, 2 * nbEdges + n - 1);
+        MXF_ClearNodeList(mxf);
+        MXF_SetNodeListSize(mxf, n + 1);
+        MXF_ClearArcList(mxf);
+        for (int e = 0; e < nbEdges; ++e)
+        {
+            const int cap = static_cast<int>(std::lround(edgeX[e] *
+                                                         cFlowScale));
+            MXF_AddArc(mxf, edgeTail[e], edgeHead[e], cap);
+            MXF_AddArc(mxf, edgeHead[e], edgeTail[e], cap);
+        }
+
+        int wSum = 0;
+        for (int i = 1; i < n; ++i)
+        {
+            const int w = static_cast<int>(std::lround(
+                2 * mVals[mIdx.q(i, k, t)] / mpInst->getCk(k) * cFlowScale));
+            MXF_AddArc(mxf, i, sink, w);
+            wSum += w;
+        }
+        MXF_CreateMates(mxf);
+
+        int cutValue = 0, sinkSideSize = 0;
+        std::vector<int> sinkSide(n + 2, 0);
+        MXF_SolveMaxFlow(mxf, 1, n, sink, &cutValue, 1, &sinkSideSize,
+                         sinkSide.data());
+        MXF_FreeMem(mxf);
+        MemArenaEnd();
+
+        if ((wSum - cutValue) / (2 * cFlowScale) <= utils::GRB_EPSILON)
+        {
+            return;
+        }
+
+        for (int i = 1; i <= sinkSideSize; ++i)
+        {
+            if (sinkSide[i] != sink)
+            {
+                setsFound[kt].push_back(sinkSide[i]);
+            }
+        }
+        std::sort(setsFound[kt].begin(), setsFound[kt].end());
+    };
+
+    if (mpSepPool)
+    {
+        mpSepPool->parallelFor(nbGraphs, separate);
+    }
+    else
+    {
+        for (int kt = 0; kt < nbGraphs; ++kt)
+        {
+            separate(kt);
+        }
+    }
+
+    /* cuts added in (k, t) order, as in addCVRPSEPCAP() */
+    for (int k = 0; k < mpInst->getK(); ++k)
+    {
+        for (int t = 0; t < T; ++t)
+        {
+            const auto& list = setsFound[k * T + t];
+            if (list.empty()) continue;
+
+            GRBLinExpr xExpr = 0, yExpr = 0, qExpr = 0;
+            double xSum = 0, ySum = 0, qSum = 0;
+            for (std::size_t i = 0; i < list.size(); ++i)
+            {
+                for (std::size_t j = i + 1; j < list.size(); ++j)
+                {
+                    const int e = mIdx.x(list[i], list[j], k, t);
+                    xExpr += mVars[e];
+                    xSum += mVals[e];
+                }
+                yExpr += mVars[mIdx.y(list[i], k, t)];
+                ySum += mVals[mIdx.y(list[i], k, t)];
+                qExpr += mVars[mIdx.q(list[i], k, t)];
+                qSum += mVals[mIdx.q(list[i], k, t)];
+            }
+
+            const double invC = 1 / mpInst->getCk(k);
+            const double violation = xSum - ySum + invC * qSum;
+            int nbAddedGraph = 0;
+            if (cstType == constrsType::lazy ||
+                violation > utils::GRB_EPSILON)
+            {
+                if (cstType == constrsType::lazy)
+                {
+                    addLazy(xExpr <= yExpr - invC * qExpr);
+                }
+                else
+                {
+                    addCut(xExpr <= yExpr - invC * qExpr);
+                }
+                nbAddedGraph = 1;
+                maxViolation = std::max(maxViolation, violation);
+            }
+
+            nbAdded += nbAddedGraph;
+            mStats.addCuts(k, t, 1, nbAddedGraph);
+            mStats.addFamily("qcap", 1, nbAddedGraph);
+        }
+    }
+
+    mStats.addViolation(maxViolation);
+
+    return nbAdded;
+}
@@ -0,0 +1,59 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: valid_ineqs.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Separation of the IRP valid inequalities as user cuts.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 08:40 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../../../include/ext/loguru/loguru.hpp"
+
+#include "../../../include/callback/callback_sec.hpp"
+#include "../../../include/utils/constants.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+int CallbackSEC::addValidIneqCuts()
+{
+    using vi = ValidInequalities;
+
+    std::vector<std::size_t> nbViolated(vi::nbFamilies, 0);
+    std::vector<GRBVar> rowVars;
+
+    auto addRowCut = [&](const std::vector<int>& ind,
+                         const std::vector<double>& val,
+                         const double rhs)
+    {
+        rowVars.clear();
+        for (auto i : ind)
+        {
+            rowVars.push_back(mVars[i]);
+        }
+
+        GRBLinExpr e = 0;
+        e.addTerms(val.data(), rowVars.data(), static_cast<int>(ind.size()));
+        addCut(e <= rhs);
+    };
+
+    mValidIneqs.separate(mVals, utils::GRB_EPSILON, nbViolated, addRowCut);
+
+    int nbAdded = 0;
+    for (int f = 0; f < vi::nbFamilies; ++f)
+    {
+        if (nbViolated[f] == 0) continue;
+
+        mStats.addFamily(vi::getName(static_cast<vi::family>(f)),
+                         nbViolated[f],
+                         nbViolated[f]);
+        nbAdded += static_cast<int>(nbViolated[f]);
+    }
+
+    return nbAdded;
+}
@@ -0,0 +1,93 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: sep_scheduler.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Policy deciding at which MIPNODE callback calls the fractional
+ * separation runs, class definition.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 04:50 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include "../../include/callback/sep_scheduler.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// the back off never makes the node frequency larger than this factor
+static const std::size_t cMaxBackoff = 64;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+SepScheduler::SepScheduler(const std::size_t nodeFreq,
+                           const double minViolation,
+                           const double backoffGain) :
+    mNodeFreq(nodeFreq),
+    mMinViolation(minViolation),
+    mBackoffGain(backoffGain),
+    mCurFreq(nodeFreq),
+    mLastNode(-1),
+    mLastBound(0),
+    mLastViolation(0)
+{}
+
+
+bool SepScheduler::isDue(const double nodeCount, const double objBound)
+{
+    /* root: every cut round */
+    if (nodeCount < 0.5)
+    {
+        mLastNode = nodeCount;
+        mLastBound = objBound;
+        return true;
+    }
+
+    /* another round at the last separated node */
+    if (nodeCount == mLastNode)
+    {
+        return mLastViolation >= mMinViolation;
+    }
+
+    if (mCurFreq == 0 || nodeCount - mLastNode < mCurFreq)
+    {
+        return false;
+    }
+
+    /* back off while the cuts do not move the bound (minimization: the bound
+       only grows) */
+    if (mBackoffGain > 0)
+    {
+        const double gain = (objBound - mLastBound) /
+            std::max(std::fabs(mLastBound), 1.0);
+        mCurFreq = gain < mBackoffGain ?
+            std::min(2 * mCurFreq, cMaxBackoff * mNodeFreq) : mNodeFreq;
+    }
+
+    mLastNode = nodeCount;
+    mLastBound = objBound;
+    return true;
+}
+
+
+void SepScheduler::record(const double maxViolation)
+{
+    mLastViolation = maxViolation;
+}
+
+
+std::size_t SepScheduler::getNodeFreq() const
+{
+    return mCurFreq;
+}
@@ -0,0 +1,250 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: sep_stats.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Statistics of the callback separation (calls, time, cuts and
+ * violations), class definition.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 04:05 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <fstream>
+
+#include "gurobi_c++.h"
+
+#include "../../include/ext/loguru/loguru.hpp"
+
+#include "../../include/callback/sep_stats.hpp"
+
+//////////////////////////////// Helper methods ////////////////////////////////
+
+namespace
+{
+
+/**
+ * @brief Name of a callback where.
+*/
+std::string whereName(const int where)
+{
+    switch (where)
+    {
+    case GRB_CB_POLLING: return "POLLING";
+    case GRB_CB_PRESOLVE: return "PRESOLVE";
+    case GRB_CB_SIMPLEX: return "SIMPLEX";
+    case GRB_CB_MIP: return "MIP";
+    case GRB_CB_MIPSOL: return "MIPSOL";
+    case GRB_CB_MIPNODE: return "MIPNODE";
+    case GRB_CB_MESSAGE: return "MESSAGE";
+    case GRB_CB_BARRIER: return "BARRIER";
+    default: return "WHERE_" + std::to_string(where);
+    }
+}
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+SepStats::SepStats(const int K, const int T) :
+    mT(T),
+    mNbSkipped(0),
+    mCuts(K * T),
+    mNbPropagated(0),
+    mNbExact(0),
+    mMaxViolation(0),
+    mLastLog(std::chrono::steady_clock::now())
+{}
+
+
+void SepStats::addCall(const int where)
+{
+    ++mNbCalls[where];
+}
+
+
+void SepStats::addSkipped()
+{
+    ++mNbSkipped;
+}
+
+
+void SepStats::addSepTime(const int where, const double time)
+{
+    mSepTime[where] += time;
+}
+
+
+void SepStats::addCuts(const int k,
+                       const int t,
+                       const std::size_t nbFound,
+                       const std::size_t nbAdded)
+{
+    DCHECK_F(k * mT + t < static_cast<int>(mCuts.size()));
+    mCuts[k * mT + t].nbFound += nbFound;
+    mCuts[k * mT + t].nbAdded += nbAdded;
+}
+
+
+void SepStats::addPropagated(const std::size_t nbAdded)
+{
+    mNbPropagated += nbAdded;
+}
+
+
+void SepStats::addExact(const std::size_t nbAdded)
+{
+    mNbExact += nbAdded;
+}
+
+
+void SepStats::addFamily(const std::string& family,
+                         const std::size_t nbFound,
+                         const std::size_t nbAdded)
+{
+    mFamilies[family].nbFound += nbFound;
+    mFamilies[family].nbAdded += nbAdded;
+}
+
+
+void SepStats::addViolation(const double violation)
+{
+    if (violation > mMaxViolation)
+    {
+        mMaxViolation = violation;
+    }
+}
+
+
+bool SepStats::isLogDue(const double period)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (std::chrono::duration<double>(now - mLastLog).count() < period)
+    {
+        return false;
+    }
+
+    mLastLog = now;
+    return true;
+}
+
+
+void SepStats::show() const
+{
+    const auto total = getTotalCuts();
+    RAW_LOG_F(INFO, "Separation: MIPSOL %zu calls (%.2f s), MIPNODE %zu calls "
+              "(%zu skipped, %.2f s), cuts %zu found / %zu added (%zu "
+              "propagated, %zu exact), max violation %.4f",
+              getNbCalls(GRB_CB_MIPSOL), getSepTime(GRB_CB_MIPSOL),
+              getNbCalls(GRB_CB_MIPNODE), mNbSkipped,
+              getSepTime(GRB_CB_MIPNODE), total.nbFound, total.nbAdded,
+              mNbPropagated, mNbExact, mMaxViolation);
+    for (const auto& [family, c] : mFamilies)
+    {
+        RAW_LOG_F(INFO, "\t%s cuts: %zu found / %zu added", family.c_str(),
+                  c.nbFound, c.nbAdded);
+    }
+}
+
+
+void SepStats::writeJSON(const std::string& path) const
+{
+    std::ofstream file(path);
+    if (!file.is_open())
+    {
+        RAW_LOG_F(ERROR, "SepStats::writeJSON(): unable to open %s",
+                  path.c_str());
+        return;
+    }
+
+    const auto total = getTotalCuts();
+    const int K = static_cast<int>(mCuts.size()) / mT;
+
+    file << "{\n";
+
+    file << "  \"calls\": {";
+    for (auto it = mNbCalls.begin(); it != mNbCalls.end(); ++it)
+    {
+        file << (it == mNbCalls.begin() ? "" : ", ") << "\""
+             << whereName(it->first) << "\": " << it->second;
+    }
+    file << "},\n";
+
+    file << "  \"sep_time\": {";
+    for (auto it = mSepTime.begin(); it != mSepTime.end(); ++it)
+    {
+        file << (it == mSepTime.begin() ? "" : ", ") << "\""
+             << whereName(it->first) << "\": " << it->second;
+    }
+    file << "},\n";
+
+    file << "  \"mipnode_skipped\": " << mNbSkipped << ",\n";
+    file << "  \"cuts_found\": " << total.nbFound << ",\n";
+    file << "  \"cuts_added\": " << total.nbAdded << ",\n";
+    file << "  \"cuts_propagated\": " << mNbPropagated << ",\n";
+    file << "  \"cuts_exact\": " << mNbExact << ",\n";
+    file << "  \"max_violation\": " << mMaxViolation << ",\n";
+
+    file << "  \"families\": {";
+    for (auto it = mFamilies.begin(); it != mFamilies.end(); ++it)
+    {
+        file << (it == mFamilies.begin() ? "" : ", ") << "\"" << it->first
+             << "\": {\"found\": " << it->second.nbFound
+             << ", \"added\": " << it->second.nbAdded << "}";
+    }
+    file << "},\n";
+
+    /* K x T matrices */
+    auto writeMatrix = [&](const std::string& key, const bool found)
+    {
+        file << "  \"" << key << "\": [";
+        for (int k = 0; k < K; ++k)
+        {
+            file << (k == 0 ? "[" : ", [");
+            for (int t = 0; t < mT; ++t)
+            {
+                const auto& c = mCuts[k * mT + t];
+                file << (t == 0 ? "" : ", ")
+                     << (found ? c.nbFound : c.nbAdded);
+            }
+            file << "]";
+        }
+        file << "]";
+    };
+
+    writeMatrix("cuts_found_kt", true);
+    file << ",\n";
+    writeMatrix("cuts_added_kt", false);
+    file << "\n}\n";
+}
+
+/////////////////////////////// private methods ////////////////////////////////
+
+std::size_t SepStats::getNbCalls(const int where) const
+{
+    auto it = mNbCalls.find(where);
+    return it != mNbCalls.end() ? it->second : 0;
+}
+
+
+double SepStats::getSepTime(const int where) const
+{
+    auto it = mSepTime.find(where);
+    return it != mSepTime.end() ? it->second : 0;
+}
+
+
+SepStats::counts SepStats::getTotalCuts() const
+{
+    counts total;
+    for (const auto& c : mCuts)
+    {
+        total.nbFound += c.nbFound;
+        total.nbAdded += c.nbAdded;
+    }
+    return total;
+}
@@ -0,0 +1,205 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: support_graph.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Sparse support graphs of the (vehicle, period) pairs in the CVRPSEP
+ * format, class definition.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 02:30 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <cmath>
+
+#include "../../include/ext/loguru/loguru.hpp"
+
+#include "../../include/callback/support_graph.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+SupportGraph::SupportGraph(const VarIndex& idx,
+                           const int nbVertices,
+                           const int K,
+                           const int T,
+                           const bool aggregated) :
+    mIdx(idx),
+    mN(nbVertices),
+    mK(K),
+    mT(T),
+    mAggregated(aggregated),
+    mGraphs(aggregated ? T : K * T)
+{
+    mVisited.reserve(mN);
+
+    /* an integer solution has at most n edges per route */
+    const int nbEdges = mAggregated ? mN + mK : mN;
+    for (auto& g : mGraphs)
+    {
+        g.edgeTail.reserve(nbEdges);
+        g.edgeHead.reserve(nbEdges);
+        g.edgeX.reserve(nbEdges);
+        g.demand.assign(mN, 0);
+    }
+}
+
+
+void SupportGraph::build(const std::vector<double>& vals, const double eps)
+{
+    DCHECK_F(static_cast<int>(vals.size()) == mIdx.size());
+
+    if (mAggregated)
+    {
+        buildAggregated(vals, eps);
+        return;
+    }
+
+    for (int k = 0; k < mK; ++k)
+    {
+        for (int t = 0; t < mT; ++t)
+        {
+            auto& g = mGraphs[k * mT + t];
+
+            g.edgeTail.clear();
+            g.edgeHead.clear();
+            g.edgeX.clear();
+
+            mVisited.clear();
+            for (int i = 0; i < mN; ++i)
+            {
+                if (vals[mIdx.y(i, k, t)] > 0)
+                {
+                    mVisited.push_back(i);
+                }
+            }
+
+            /* the visited vertices are sorted, so the edges keep the e(i, j)
+               order */
+            const double* xVal = vals.data() + mIdx.xBegin(k, t);
+            for (std::size_t a = 0; a < mVisited.size(); ++a)
+            {
+                const int i = mVisited[a];
+                for (std::size_t b = a + 1; b < mVisited.size(); ++b)
+                {
+                    const int j = mVisited[b];
+                    const double x = xVal[mIdx.edge(i, j)];
+                    if (x > eps)
+                    {
+                        g.edgeTail.push_back(i == 0 ? mN : i);
+                        g.edgeHead.push_back(j);
+                        g.edgeX.push_back(x);
+                    }
+                }
+            }
+
+            for (int i = 1; i < mN; ++i)
+            {
+                g.demand[i] =
+                    static_cast<int>(std::ceil(vals[mIdx.q(i, k, t)]));
+            }
+        }
+    }
+}
+
+
+int SupportGraph::getNbEdges(const int k, const int t) const
+{
+    return static_cast<int>(mGraphs[getGraphIdx(k, t)].edgeX.size());
+}
+
+
+int* SupportGraph::getEdgeTail(const int k, const int t)
+{
+    return mGraphs[getGraphIdx(k, t)].edgeTail.data();
+}
+
+
+int* SupportGraph::getEdgeHead(const int k, const int t)
+{
+    return mGraphs[getGraphIdx(k, t)].edgeHead.data();
+}
+
+
+double* SupportGraph::getEdgeX(const int k, const int t)
+{
+    return mGraphs[getGraphIdx(k, t)].edgeX.data();
+}
+
+
+int* SupportGraph::getDemand(const int k, const int t)
+{
+    return mGraphs[getGraphIdx(k, t)].demand.data();
+}
+
+/////////////////////////////// private methods ////////////////////////////////
+
+int SupportGraph::getGraphIdx(const int k, const int t) const
+{
+    DCHECK_F(!mAggregated || k == 0);
+    const int idx = mAggregated ? t : k * mT + t;
+    DCHECK_F(idx < static_cast<int>(mGraphs.size()));
+    return idx;
+}
+
+
+void SupportGraph::buildAggregated(const std::vector<double>& vals,
+                                   const double eps)
+{
+    for (int t = 0; t < mT; ++t)
+    {
+        auto& g = mGraphs[t];
+
+        g.edgeTail.clear();
+        g.edgeHead.clear();
+        g.edgeX.clear();
+
+        /* x_ijkt > 0 for some k implies y_ikt > 0 for that k */
+        mVisited.clear();
+        for (int i = 0; i < mN; ++i)
+        {
+            for (int k = 0; k < mK; ++k)
+            {
+                if (vals[mIdx.y(i, k, t)] > 0)
+                {
+                    mVisited.push_back(i);
+                    break;
+                }
+            }
+        }
+
+        for (std::size_t a = 0; a < mVisited.size(); ++a)
+        {
+            const int i = mVisited[a];
+            for (std::size_t b = a + 1; b < mVisited.size(); ++b)
+            {
+                const int j = mVisited[b];
+                double x = 0;
+                for (int k = 0; k < mK; ++k)
+                {
+                    x += vals[mIdx.x(i, j, k, t)];
+                }
+
+                if (x > eps)
+                {
+                    g.edgeTail.push_back(i == 0 ? mN : i);
+                    g.edgeHead.push_back(j);
+                    g.edgeX.push_back(x);
+                }
+            }
+        }
+
+        for (int i = 1; i < mN; ++i)
+        {
+            double q = 0;
+            for (int k = 0; k < mK; ++k)
+            {
+                q += vals[mIdx.q(i, k, t)];
+            }
+            g.demand[i] = static_cast<int>(std::ceil(q));
+        }
+    }
+}
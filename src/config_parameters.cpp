@@ -35,9 +35,39 @@ const std::string c_output_dir = "output_dir";
 const std::string c_solver_show_log = "solver_show_log";
 const std::string c_solver_time_limit = "solver_time_limit";
 const std::string c_solver_nb_threads = "solver_nb_threads";
+const std::string c_solver_sep_nb_threads = "solver_sep_nb_threads";
+const std::string c_solver_sep_aggregated = "solver_sep_aggregated";
+const std::string c_solver_sep_propagate = "solver_sep_propagate";
+const std::string c_solver_sep_node_freq = "solver_sep_node_freq";
+const std::string c_solver_sep_min_violation = "solver_sep_min_violation";
+const std::string c_solver_sep_backoff_gain = "solver_sep_backoff_gain";
+const std::string c_solver_sep_exact_nodes = "solver_sep_exact_nodes";
+const std::string c_solver_sep_cap = "solver_sep_cap";
+const std::string c_solver_sep_mstar = "solver_sep_mstar";
+const std::string c_solver_sep_qcap = "solver_sep_qcap";
 const std::string c_nb_vehicles = "nb_vehicles";
 const std::string c_model_policy = "model_policy";
 const std::string c_sec_strategy = "sec_strategy";
+const std::string c_vi_depot_edge = "vi_depot_edge";
+const std::string c_vi_depot_visit = "vi_depot_visit";
+const std::string c_vi_min_visits = "vi_min_visits";
+const std::string c_vi_inventory = "vi_inventory";
+const std::string c_model_names = "model_names";
+
+/**
+ * @brief Value of an optional parameter.
+ * @param: parameters read from the configuration file.
+ * @param: parameter label.
+ * @param: value used if the parameter is not in the configuration file.
+ * @return: std::string: parameter value.
+*/
+std::string getOptional(const std::map<std::string, std::string>& data,
+                        const std::string& key,
+                        const std::string& defaultValue)
+{
+    auto it = data.find(key);
+    return it != data.end() ? it->second : defaultValue;
+}
 
 /**
  * @brief Parse string to boolean.
@@ -61,6 +91,18 @@ std::size_t parseUint(const std::string& str)
     return static_cast<std::size_t>(val);
 }
 
+/**
+ * @brief Parse string to a non-negative double.
+ * @param: const std::string &: string to be parsed.
+ * @return: double: parsed value.
+*/
+double parseUdouble(const std::string& str)
+{
+    double val = std::stod(str);
+    CHECK_F(val >= 0, "Input parameter: Invalid value");
+    return val;
+}
+
 /**
  * @brief Parse string to unsigned int. It also checks if the input string is
  * set to max. If so, then parse to max value.
@@ -112,6 +154,21 @@ ConfigParameters::model::sec_opt parseSECOpt(const std::string &str)
     }
 }
 
+/**
+ * @brief Parse string to a valid inequalities family option.
+*/
+ConfigParameters::model::vi_opt parseVIOpt(const std::string &str)
+{
+    switch (std::stoi(str))
+    {
+    case 0: return ConfigParameters::model::vi_opt::OFF;
+    case 1: return ConfigParameters::model::vi_opt::STATIC;
+    default:
+        CHECK_F(std::stoi(str) == 2);
+        return ConfigParameters::model::vi_opt::CUT;
+    }
+}
+
 /**
  * @brief.
  * @param:.
@@ -227,8 +284,38 @@ void ConfigParameters::setupParameters()
     mSolverParam.show_log = parseBool(mData[c_solver_show_log]);
     mSolverParam.time_limit = parseUint(mData[c_solver_time_limit]);
     mSolverParam.nb_threads = parseNbThreads(mData[c_solver_nb_threads]);
+    mSolverParam.sep_nb_threads = parseNbThreads(
+        getOptional(mData, c_solver_sep_nb_threads, "1"));
+    mSolverParam.sep_aggregated = parseBool(
+        getOptional(mData, c_solver_sep_aggregated, "false"));
+    mSolverParam.sep_propagate = parseBool(
+        getOptional(mData, c_solver_sep_propagate, "false"));
+    mSolverParam.sep_node_freq = parseUint(
+        getOptional(mData, c_solver_sep_node_freq, "1"));
+    mSolverParam.sep_min_violation = parseUdouble(
+        getOptional(mData, c_solver_sep_min_violation, "0"));
+    mSolverParam.sep_backoff_gain = parseUdouble(
+        getOptional(mData, c_solver_sep_backoff_gain, "0"));
+    mSolverParam.sep_exact_nodes = parseUint(
+        getOptional(mData, c_solver_sep_exact_nodes, "0"));
+    mSolverParam.sep_cap = parseBool(
+        getOptional(mData, c_solver_sep_cap, "true"));
+    mSolverParam.sep_mstar = parseBool(
+        getOptional(mData, c_solver_sep_mstar, "false"));
+    mSolverParam.sep_qcap = parseBool(
+        getOptional(mData, c_solver_sep_qcap, "false"));
     // ---- Model parameters ----
     mModelParam.K_ = parseUint(mData[c_nb_vehicles]);
     mModelParam.policy = parsePolicyOpt(mData[c_model_policy]);
     mModelParam.sec_strategy = parseSECOpt(mData[c_sec_strategy]);
+    mModelParam.vi_depot_edge = parseVIOpt(
+        getOptional(mData, c_vi_depot_edge, "0"));
+    mModelParam.vi_depot_visit = parseVIOpt(
+        getOptional(mData, c_vi_depot_visit, "0"));
+    mModelParam.vi_min_visits = parseVIOpt(
+        getOptional(mData, c_vi_min_visits, "0"));
+    mModelParam.vi_inventory = parseVIOpt(
+        getOptional(mData, c_vi_inventory, "0"));
+    mModelParam.names = parseBool(
+        getOptional(mData, c_model_names, "false"));
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 
 #include "../../../include/ext/cvrpsep/memmod.h"
 #include "../../../include/ext/cvrpsep/basegrph.h"
+#include "../../../include/ext/cvrpsep/csrgraph.h"
+#include "../../../include/ext/cvrpsep/spmatrix.h"
 #include "../../../include/ext/cvrpsep/sort.h"
 #include "../../../include/ext/cvrpsep/cnstrmgr.h"
 #include "../../../include/ext/cvrpsep/cutbase.h"
@@ -82,16 +84,16 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
   int CutsBeforeLastProc;
   int CutNr,NodeListSize,NodeSum;
   int MinV;
-  double XSumInSet,LHS,RHS,Violation,EpsViolation,EpsInt;
+  double XSumInSet,LHS,RHS,Violation,EpsViolation,EpsInt,XVal;
   int *SuperDemand;
   int *SuperNodeSize;
   int *NodeList;
   double *XInSuperNode;
-  double **XMatrix;
-  double **SMatrix;
-  ReachPtr SupportPtr;
+  SparseMatrixPtr XMatrix;
+  SparseMatrixPtr SMatrix;
+  CSRGraphPtr SupportPtr;
   ReachPtr V1CutsPtr;
-  ReachPtr SAdjRPtr;
+  CSRGraphPtr SAdjPtr;
   ReachPtr SuperNodesRPtr;
   ReachPtr CapCutsRPtr;
   ReachPtr AntiSetsRPtr;
@@ -100,8 +102,7 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
   EpsViolation = 0.01;
   *IntegerAndFeasible = 0;
 
-  ReachInitMem(&SupportPtr,NoOfCustomers+1);
-  ReachInitMem(&SAdjRPtr,NoOfCustomers+1);
+  SAdjPtr = NULL;
   ReachInitMem(&SuperNodesRPtr,NoOfCustomers+1);
   ReachInitMem(&CapCutsRPtr,MaxNoOfCuts);
   ReachInitMem(&OrigCapCutsRPtr,MaxNoOfCuts);
@@ -112,21 +113,19 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
   NodeList = MemGetIV(NoOfCustomers+1);
   XInSuperNode = MemGetDV(NoOfCustomers+1);
 
-  SMatrix = MemGetDM(NoOfCustomers+2,NoOfCustomers+2);
-  XMatrix = MemGetDM(NoOfCustomers+2,NoOfCustomers+2);
-  for (i=1; i<=NoOfCustomers+1; i++)
-  for (j=1; j<=NoOfCustomers+1; j++)
-  XMatrix[i][j] = 0.0;
+  /* Sparse: O(NoOfEdges) memory instead of (NoOfCustomers+2)^2. */
+  SPM_InitMem(&SMatrix,NoOfCustomers+1,2*NoOfEdges);
+  SPM_InitMem(&XMatrix,NoOfCustomers+1,2*NoOfEdges);
+  SPM_Clear(XMatrix,NoOfCustomers+1);
 
+  CSR_CreateFromEdges(&SupportPtr,NoOfCustomers+1,NoOfEdges,
+                      EdgeTail,EdgeHead);
 
   for (i=1; i<=NoOfEdges; i++)
   {
-    ReachAddForwArc(SupportPtr,EdgeTail[i],EdgeHead[i]);
-    ReachAddForwArc(SupportPtr,EdgeHead[i],EdgeTail[i]);
-
-    XMatrix[EdgeTail[i]][EdgeHead[i]] = EdgeX[i];
-    XMatrix[EdgeHead[i]][EdgeTail[i]] = EdgeX[i];
+    SPM_AddSym(XMatrix,EdgeTail[i],EdgeHead[i],EdgeX[i]);
   }
+  SPM_Finish(XMatrix);
 
   *MaxViolation = 0.0;
   GeneratedCuts = 0;
@@ -167,13 +166,14 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
   EpsInt = EpsForIntegrality;
   for (i=1; i<=NoOfCustomers; i++)
   {
-    for (k=1; k<=SupportPtr->LP[i].CFN; k++)
+    for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
     {
-      j = SupportPtr->LP[i].FAL[k];
+      j = SupportPtr->ArcHead[k];
       if (j < i) continue;
 
-      if (((XMatrix[i][j] >= EpsInt) && (XMatrix[i][j] <= (1.0-EpsInt))) ||
-          ((XMatrix[i][j] >= (1.0+EpsInt)) && (XMatrix[i][j] <= (2.0-EpsInt))))
+      XVal = SPM_Get(XMatrix,i,j);
+      if (((XVal >= EpsInt) && (XVal <= (1.0-EpsInt))) ||
+          ((XVal >= (1.0+EpsInt)) && (XVal <= (2.0-EpsInt))))
       {
         *IntegerAndFeasible = 0;
         goto NotIntegerAndFeasible;
@@ -194,7 +194,7 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
                        SMatrix,
                        NoOfV1Cuts,
                        V1CutsPtr,
-                       SAdjRPtr,
+                       &SAdjPtr,
                        SuperNodesRPtr,
                        &ShrunkGraphCustNodes);
 
@@ -204,7 +204,7 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
   for (i=1; i<=ShrunkGraphCustNodes; i++)
   {
     SuperNodeSize[i] = SuperNodesRPtr->LP[i].CFN;
-    XInSuperNode[i] = SMatrix[i][i];
+    XInSuperNode[i] = SPM_Get(SMatrix,i,i);
 
     SuperDemand[i] = 0;
     for (j=1; j<=SuperNodesRPtr->LP[i].CFN; j++)
@@ -217,7 +217,7 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
   FCapFixRounds = 3;
   MaxCuts = MaxNoOfCuts / 2;
 
-  FCAPFIX_ComputeCuts(SAdjRPtr,
+  FCAPFIX_ComputeCuts(SAdjPtr,
                       ShrunkGraphCustNodes,
                       SuperDemand,
                       CAP,
@@ -254,7 +254,7 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
   ReachPtrExpandDim(AntiSetsRPtr,CapCutsRPtr->n + ShrunkGraphCustNodes);
 
   MaxCuts = MaxNoOfCuts; /* Now allow up to the total maximum */
-  GRSEARCH_CapCuts(SAdjRPtr,
+  GRSEARCH_CapCuts(SAdjPtr,
                    ShrunkGraphCustNodes,
                    SuperDemand,
                    CAP,
@@ -322,7 +322,7 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
 
   if (GeneratedCuts < MaxNoOfCuts)
   {
-    GRSEARCH_AddDropCapsOnGS(SAdjRPtr,
+    GRSEARCH_AddDropCapsOnGS(SAdjPtr,
                              NoOfCustomers,
                              ShrunkGraphCustNodes,
                              SuperDemand,CAP,
@@ -382,11 +382,11 @@ void CAPSEP_SeparateCapCuts(int NoOfCustomers,
   MemFree(NodeList);
   MemFree(XInSuperNode);
 
-  MemFreeDM(SMatrix,NoOfCustomers+2);
-  MemFreeDM(XMatrix,NoOfCustomers+2);
+  SPM_FreeMem(&SMatrix);
+  SPM_FreeMem(&XMatrix);
 
-  ReachFreeMem(&SupportPtr);
-  ReachFreeMem(&SAdjRPtr);
+  CSR_FreeMem(&SupportPtr);
+  CSR_FreeMem(&SAdjPtr);
   ReachFreeMem(&SuperNodesRPtr);
   ReachFreeMem(&CapCutsRPtr);
   ReachFreeMem(&AntiSetsRPtr);
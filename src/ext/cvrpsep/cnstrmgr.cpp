@@ -9,18 +9,133 @@
 #include "../../../include/ext/cvrpsep/cnstrmgr.h"
 #include "../../../include/ext/cvrpsep/memmod.h"
 
-void CMGR_CreateCMgr(CnstrMgrPointer *CMP, int Dim)
+#define CMGR_MIN_HASH_SIZE 64
+
+static unsigned int LCMGR_HashList(int ListSize, int *List)
 {
+  /* Depends on the set only (not on the order of List): the node sum and
+     the sum of the mixed node numbers. */
   int i;
+  unsigned int NodeSum,MixSum,x;
+
+  NodeSum = 0;
+  MixSum = (unsigned int) ListSize;
+  for (i=1; i<=ListSize; i++)
+  {
+    x = (unsigned int) List[i];
+    NodeSum += x;
+
+    x *= 0x9E3779B1u;
+    x ^= x >> 15;
+    x *= 0x85EBCA77u;
+    x ^= x >> 13;
+    MixSum += x;
+  }
+
+  return MixSum ^ (NodeSum * 0xC2B2AE35u);
+}
+
+static void LCMGR_UpdateIndex(CnstrMgrPointer CMP)
+{
+  /* Indexes CPL[HashedSize..Size-1]. The index is rebuilt when it is reset
+     (HashedSize = 0) or when there are more constraints than buckets. */
+  int i,b,ArenaActive;
+
+  if (CMP->HashedSize >= CMP->Size) return;
+
+  if (CMP->Size > CMP->HashSize)
+  {
+    while (CMP->HashSize < CMP->Size) CMP->HashSize *= 2;
+
+    ArenaActive = MemArenaSuspend();
+    MemFree(CMP->HashFirst);
+    CMP->HashFirst = MemGetIV(CMP->HashSize);
+    MemArenaResume(ArenaActive);
+
+    CMP->HashedSize = 0;
+  }
+
+  if (CMP->HashedSize == 0)
+  {
+    for (b=0; b<CMP->HashSize; b++) CMP->HashFirst[b] = 0;
+  }
+
+  for (i=CMP->HashedSize; i<CMP->Size; i++)
+  {
+    CMP->HashNext[i] = 0;
+    if (CMP->CPL[i] == NULL) continue;
+    if (CMP->CPL[i]->CType != CMGR_CT_CAP) continue;
+
+    CMP->HashKey[i] = LCMGR_HashList(CMP->CPL[i]->IntListSize,
+                                     CMP->CPL[i]->IntList);
+    b = (int) (CMP->HashKey[i] & (unsigned int) (CMP->HashSize - 1));
+    CMP->HashNext[i] = CMP->HashFirst[b];
+    CMP->HashFirst[b] = i + 1;
+  }
+
+  CMP->HashedSize = CMP->Size;
+}
+
+static int LCMGR_FindCap(CnstrMgrPointer CMP,
+                         int IntListSize, int *IntList)
+{
+  /* Index of a capacity constraint with this IntList (-1 if none). */
+  char Equal;
+  int i,Idx;
+  unsigned int Key;
+
+  LCMGR_UpdateIndex(CMP);
+
+  Key = LCMGR_HashList(IntListSize,IntList);
+  Idx = CMP->HashFirst[Key & (unsigned int) (CMP->HashSize - 1)] - 1;
+  for (; Idx >= 0; Idx = CMP->HashNext[Idx] - 1)
+  {
+    /* Cleared (or moved) constraints stay in their buckets. */
+    if (CMP->CPL[Idx] == NULL) continue;
+    if (CMP->CPL[Idx]->CType != CMGR_CT_CAP) continue;
+    if (CMP->HashKey[Idx] != Key) continue;
+    if (CMP->CPL[Idx]->IntListSize != IntListSize) continue;
+
+    Equal = 1;
+    for (i=1; i<=IntListSize; i++)
+    {
+      if (CMP->CPL[Idx]->IntList[i] != IntList[i])
+      {
+        Equal = 0;
+        break;
+      }
+    }
+
+    if (Equal) return Idx;
+  }
+
+  return -1;
+}
+
+void CMGR_CreateCMgr(CnstrMgrPointer *CMP, int Dim)
+{
+  int i,ArenaActive;
 
+  /* Constraint managers outlive the separation (no arena). */
+  ArenaActive = MemArenaSuspend();
   (*CMP) = (CnstrMgrPointer) MemGet(sizeof(CnstrMgrRecord));
   (*CMP)->Dim  = Dim;
   (*CMP)->Size = 0;
   (*CMP)->CPL  = (CnstrPointerList) MemGet(sizeof(CnstrPointer)*Dim);
 
+  (*CMP)->HashSize = CMGR_MIN_HASH_SIZE;
+  (*CMP)->HashedSize = 0;
+  (*CMP)->HashFirst = MemGetIV(CMGR_MIN_HASH_SIZE);
+  (*CMP)->HashNext = MemGetIV(Dim);
+  (*CMP)->HashKey = (unsigned int *) MemGet(sizeof(unsigned int)*Dim);
+  MemArenaResume(ArenaActive);
+
   for (i=0; i<Dim; i++) /* 0..Dim-1. */
   (*CMP)->CPL[i] = NULL;
 
+  for (i=0; i<CMGR_MIN_HASH_SIZE; i++)
+  (*CMP)->HashFirst[i] = 0;
+
   /* (*CMP)->CPL[i] = (CnstrPointer) MemGet(sizeof(CnstrRecord)); */
 
   /*
@@ -43,6 +158,9 @@ void CMGR_ExpandCMgr(CnstrMgrPointer CMP, int NewDim)
   if (NewDim <= CMP->Dim) return;
 
   CMP->CPL = (CnstrPointerList) MemReGet(CMP->CPL,sizeof(CnstrPointer)*NewDim);
+  CMP->HashNext = (int *) MemReGet(CMP->HashNext,sizeof(int)*NewDim);
+  CMP->HashKey = (unsigned int *) MemReGet(CMP->HashKey,
+                                           sizeof(unsigned int)*NewDim);
 
   for (i=CMP->Dim; i<NewDim; i++) /* First available position is Dim. */
                                   /* (0..Dim-1 were used before). */
@@ -79,15 +197,21 @@ void CMGR_FreeMemCMgr(CnstrMgrPointer *CMP)
   }
 
   MemFree((*CMP)->CPL);
+  MemFree((*CMP)->HashFirst);
+  MemFree((*CMP)->HashNext);
+  MemFree((*CMP)->HashKey);
   MemFree(*CMP);
   *CMP = NULL;
 }
 
-void CMGR_AddCnstr(CnstrMgrPointer CMP,
-                   int CType, int Key, int IntListSize, int *IntList,
-                   double RHS)
+static void LCMGR_AppendCnstr(CnstrMgrPointer CMP,
+                              int CType, int Key,
+                              int IntListSize, int *IntList,
+                              double RHS)
 {
-  int i,j;
+  int i,j,ArenaActive;
+
+  ArenaActive = MemArenaSuspend();
 
   if (CMP->Dim <= CMP->Size)
   {
@@ -124,6 +248,20 @@ void CMGR_AddCnstr(CnstrMgrPointer CMP,
   CMP->CPL[i]->CoeffList   = NULL;
 
   CMP->CPL[i]->BranchLevel = 0;
+
+  MemArenaResume(ArenaActive);
+}
+
+void CMGR_AddCnstr(CnstrMgrPointer CMP,
+                   int CType, int Key, int IntListSize, int *IntList,
+                   double RHS)
+{
+  if (CType == CMGR_CT_CAP)
+  {
+    if (LCMGR_FindCap(CMP,IntListSize,IntList) >= 0) return;
+  }
+
+  LCMGR_AppendCnstr(CMP,CType,Key,IntListSize,IntList,RHS);
 }
 
 void CMGR_AddBranchCnstr(CnstrMgrPointer CMP,
@@ -133,7 +271,7 @@ void CMGR_AddBranchCnstr(CnstrMgrPointer CMP,
 {
   int i;
 
-  CMGR_AddCnstr(CMP,CType,Key,IntListSize,IntList,RHS);
+  LCMGR_AppendCnstr(CMP,CType,Key,IntListSize,IntList,RHS);
 
   i = CMP->Size - 1;
   CMP->CPL[i]->BranchLevel = BranchLevel;
@@ -145,16 +283,18 @@ void CMGR_AddExtCnstr(CnstrMgrPointer CMP,
                       int ExtListSize, int *ExtList,
                       double RHS)
 {
-  int i,j;
+  int i,j,ArenaActive;
 
-  CMGR_AddCnstr(CMP,CType,Key,IntListSize,IntList,RHS);
+  LCMGR_AppendCnstr(CMP,CType,Key,IntListSize,IntList,RHS);
   if (ExtListSize > 0)
   {
     i = CMP->Size - 1;
 
     CMP->CPL[i]->ExtListSize = ExtListSize;
 
+    ArenaActive = MemArenaSuspend();
     CMP->CPL[i]->ExtList = MemGetIV(ExtListSize+1);
+    MemArenaResume(ArenaActive);
 
     for (j=1; j<=ExtListSize; j++)
     CMP->CPL[i]->ExtList[j] = ExtList[j];
@@ -169,20 +309,22 @@ void CMGR_AddExplicitCnstr(CnstrMgrPointer CMP,
                            double *CoeffList,
                            double RHS)
 {
-  int i,j;
+  int i,j,ArenaActive;
 
-  CMGR_AddCnstr(CMP,CType,Key,ListSize,IntList,RHS);
+  LCMGR_AppendCnstr(CMP,CType,Key,ListSize,IntList,RHS);
 
   i = CMP->Size - 1;
 
   CMP->CPL[i]->ExtListSize = ListSize;
 
+  ArenaActive = MemArenaSuspend();
   CMP->CPL[i]->ExtList = MemGetIV(ListSize+1);
 
   for (j=1; j<=ListSize; j++)
   CMP->CPL[i]->ExtList[j] = ExtList[j];
 
   CMP->CPL[i]->CoeffList = MemGetDV(ListSize+1);
+  MemArenaResume(ArenaActive);
 
   for (j=1; j<=ListSize; j++)
   CMP->CPL[i]->CoeffList[j] = CoeffList[j];
@@ -195,13 +337,15 @@ void CMGR_AddGomoryCnstr(CnstrMgrPointer CMP,
                          double *CoeffList,
                          double RHS) /* >= RHS */
 {
-  int i,j;
+  int i,j,ArenaActive;
 
-  CMGR_AddCnstr(CMP,CType,Key,ListSize,IntList,RHS);
+  LCMGR_AppendCnstr(CMP,CType,Key,ListSize,IntList,RHS);
 
   i = CMP->Size - 1;
 
+  ArenaActive = MemArenaSuspend();
   CMP->CPL[i]->CoeffList = MemGetDV(ListSize+1);
+  MemArenaResume(ArenaActive);
 
   for (j=1; j<=ListSize; j++)
   CMP->CPL[i]->CoeffList[j] = CoeffList[j];
@@ -470,36 +614,8 @@ void CMGR_SearchCap(CnstrMgrPointer CMP,
                     int IntListSize, int *IntList,
                     char *CapExists)
 {
-  char Diff;
-  int i,j,k,Idx;
-
   *CapExists = 0;
-
-  for (Idx=0; Idx<CMP->Size; Idx++)
-  {
-    if (CMP->CPL[Idx]->CType != CMGR_CT_CAP) continue;
-
-    if (IntListSize != CMP->CPL[Idx]->IntListSize) continue;
-
-    Diff = 0;
-    for (i=1; i<=IntListSize; i++)
-    {
-      j = IntList[i];
-      k = CMP->CPL[Idx]->IntList[i];
-
-      if (j != k)
-      {
-        Diff = 1;
-        break;
-      }
-    }
-
-    if (Diff == 0)
-    {
-      *CapExists = 1;
-      break;
-    }
-  }
+  if (LCMGR_FindCap(CMP,IntListSize,IntList) >= 0) *CapExists = 1;
 }
 
 
@@ -532,7 +648,7 @@ void CMGR_AddPartialMStar(CnstrMgrPointer CMP,
                           int A, int B, int L)
 {
   char Dominated;
-  int i,j;
+  int i,j,ArenaActive;
 
   if (CListSize > 0) SortIVInc(CList,CListSize);
 
@@ -560,7 +676,9 @@ void CMGR_AddPartialMStar(CnstrMgrPointer CMP,
 
   if (CListSize > 0)
   {
+    ArenaActive = MemArenaSuspend();
     CMP->CPL[i]->CList = MemGetIV(CListSize+1);
+    MemArenaResume(ArenaActive);
 
     for (j=1; j<=CListSize; j++)
     CMP->CPL[i]->CList[j] = CList[j];
@@ -587,6 +705,10 @@ void CMGR_MoveCnstr(CnstrMgrPointer SourcePtr,
     (SinkPtr->Size)++;
     SinkIndex = SinkPtr->Size - 1;
   }
+  else
+  {
+    SinkPtr->HashedSize = 0; /* CPL[SinkIndex] is replaced. */
+  }
 
   SinkPtr->CPL[SinkIndex] = SourcePtr->CPL[SourceIndex];
   SourcePtr->CPL[SourceIndex] = NULL;
@@ -630,6 +752,7 @@ void CMGR_CompressCMP(CnstrMgrPointer CMP)
 	}
 
 	(CMP->Size) -= Delta;
+	CMP->HashedSize = 0; /* The constraints have new indices. */
 }
 
 void CMGR_ChgRHS(CnstrMgrPointer CMP, int CnstrNr, double NewRHS)
@@ -8,20 +8,23 @@
 
 #include "../../../include/ext/cvrpsep/memmod.h"
 #include "../../../include/ext/cvrpsep/basegrph.h"
+#include "../../../include/ext/cvrpsep/csrgraph.h"
+#include "../../../include/ext/cvrpsep/spmatrix.h"
 #include "../../../include/ext/cvrpsep/strngcmp.h"
 #include "../../../include/ext/cvrpsep/cnstrmgr.h"
 #include "../../../include/ext/cvrpsep/compcuts.h"
 
-void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
+void COMPCUTS_ComputeCompCuts(CSRGraphPtr SupportPtr,
                               int NoOfCustomers,
                               int *Demand,
                               int CAP,
-                              double **XMatrix,
+                              SparseMatrixPtr XMatrix,
                               CnstrMgrPointer CutsCMP,
                               int *GeneratedCuts)
 {
   int i,j,k;
-  int TotalNodes,NoOfComponents,DepotCompNr,DepotDegree,NodeListSize,CutNr;
+  int TotalNodes,NoOfComponents,DepotCompNr,DepotDegree,NodeListSize;
+  int CutsBefore;
   int CAPSum,MinV,TotalDemand,ComplementDemand;
   int DemandSum;
   double EpsViolation;
@@ -39,7 +42,7 @@ void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
 
   ReachPtr CompsRPtr;
 
-  CutNr = 0;
+  CutsBefore = CutsCMP->Size;
   EpsViolation = 0.01;
 
   TotalNodes = NoOfCustomers + 1;
@@ -56,13 +59,15 @@ void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
 
   ReachInitMem(&CompsRPtr,TotalNodes);
 
-  DepotDegree = SupportPtr->LP[TotalNodes].CFN;
-  SupportPtr->LP[TotalNodes].CFN = 0;
-  ComputeStrongComponents(SupportPtr,CompsRPtr,
-                          &NoOfComponents,TotalNodes,
-                          CVWrk1,
-                          IVWrk1,IVWrk2,IVWrk3,IVWrk4);
-  SupportPtr->LP[TotalNodes].CFN = DepotDegree;
+  /* The depot (the last node) is left out by emptying its list. */
+  DepotDegree = SupportPtr->FirstArc[TotalNodes+1] -
+                SupportPtr->FirstArc[TotalNodes];
+  SupportPtr->FirstArc[TotalNodes+1] = SupportPtr->FirstArc[TotalNodes];
+  ComputeStrongComponentsCSR(SupportPtr,CompsRPtr,
+                             &NoOfComponents,TotalNodes,
+                             CVWrk1,
+                             IVWrk1,IVWrk2,IVWrk3,IVWrk4);
+  SupportPtr->FirstArc[TotalNodes+1] += DepotDegree;
 
   /* The number of components excl. the depot is NoOfComponents-1 */
 
@@ -90,11 +95,11 @@ void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
 
   for (i=1; i<NoOfCustomers; i++)
   {
-    for (j=1; j<=SupportPtr->LP[i].CFN; j++)
+    for (j=SupportPtr->FirstArc[i]; j<SupportPtr->FirstArc[i+1]; j++)
     {
-      k = SupportPtr->LP[i].FAL[j];
+      k = SupportPtr->ArcHead[j];
       if ((k > i) && (k <= NoOfCustomers)) /* Only one of (i,k) and (k,i). */
-      CompXSum[CompNr[i]] += XMatrix[i][k];
+      CompXSum[CompNr[i]] += SPM_Get(XMatrix,i,k);
     }
   }
 
@@ -122,8 +127,6 @@ void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
 
     if ((LHS - RHS) >= EpsViolation)
     {
-      CutNr++;
-
       CMGR_AddCnstr(CutsCMP,
                     CMGR_CT_CAP,0,
                     CompsRPtr->LP[i].CFN,
@@ -154,8 +157,6 @@ void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
 
       if ((LHS - RHS) >= EpsViolation)
       {
-        CutNr++;
-
         NodeListSize = 0;
         for (j=1; j<=NoOfCustomers; j++)
         if (CompNr[j] != i)
@@ -179,9 +180,10 @@ void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
     for (i=1; i<=NoOfComponents; i++) ConnectedToDepot[i] = 0;
 
     /* DepotIndex = TotalNodes. */
-    for (i=1; i<=SupportPtr->LP[TotalNodes].CFN; i++)
+    for (i=SupportPtr->FirstArc[TotalNodes];
+         i<SupportPtr->FirstArc[TotalNodes+1]; i++)
     {
-      j = SupportPtr->LP[TotalNodes].FAL[i];
+      j = SupportPtr->ArcHead[i];
       k = CompNr[j];
       ConnectedToDepot[k] = 1;
     }
@@ -240,7 +242,6 @@ void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
 
       if ((LHS - RHS) >= EpsViolation)
       {
-        CutNr++;
         CMGR_AddCnstr(CutsCMP,
                       CMGR_CT_CAP,0,
                       NodeListSize,
@@ -254,7 +255,8 @@ void COMPCUTS_ComputeCompCuts(ReachPtr SupportPtr,
 
   EndOfCompCuts:
 
-  *GeneratedCuts = CutNr;
+  /* CMGR_AddCnstr() skips the sets already in CutsCMP. */
+  *GeneratedCuts = CutsCMP->Size - CutsBefore;
 
   MemFree(CVWrk1);
 
@@ -7,14 +7,16 @@
 
 #include "../../../include/ext/cvrpsep/memmod.h"
 #include "../../../include/ext/cvrpsep/basegrph.h"
-#include "../../../include/ext/cvrpsep/strngcmp.h"
+#include "../../../include/ext/cvrpsep/csrgraph.h"
+#include "../../../include/ext/cvrpsep/spmatrix.h"
+#include "../../../include/ext/cvrpsep/sort.h"
 #include "../../../include/ext/cvrpsep/cutbase.h"
 #include "../../../include/ext/cvrpsep/compress.h"
 
-void COMPRESS_CheckV1Set(ReachPtr SupportPtr,
+void COMPRESS_CheckV1Set(CSRGraphPtr SupportPtr,
                          int NoOfCustomers,
                          int *CompNr,
-                         double **XMatrix,
+                         SparseMatrixPtr XMatrix,
                          double *Slack,
                          int *CompListSize,
                          int *CompList,
@@ -55,35 +57,236 @@ void COMPRESS_CheckV1Set(ReachPtr SupportPtr,
   MemFree(CompInSet);
 }
 
-void COMPRESS_ShrinkGraph(ReachPtr SupportPtr,
+/* Supernodes of COMPRESS_ShrinkGraph as a union-find over the nodes (the
+   depot is never merged). The x-sums between supernodes are kept in a
+   hash table keyed by the pair of roots; on a union the entries of the
+   supernode with the shorter arc list are moved to the other one. */
+
+typedef struct
+{
+  int *Parent;
+  int *Size; /* Nodes in the supernode of a root */
+  double *Diag; /* x-sum of the edges inside the supernode of a root */
+
+  /* Arc list of a root: the support arcs of its nodes, concatenated on
+     union. Heads are original nodes, so they may be repeated and inside
+     the supernode. */
+  int *FirstArc, *LastArc, *ListSize;
+  int *NextArc, *ArcHead;
+
+  /* Hash table (separate chaining) of the x-sums between two roots,
+     Tail < Head. Deleted entries go to a free list. */
+  int HashMask;
+  int *HashFirst;
+  int *EntryNext, *EntryTail, *EntryHead;
+  double *EntryX;
+  int NoOfEntries, FreeEntry;
+
+  int *Mark; /* Mark[r] == MarkNr: root r already visited */
+  int MarkNr;
+} ShrinkRec;
+
+static int LCOMPRESS_Find(ShrinkRec *S, int i)
+{
+  while (S->Parent[i] != i)
+  {
+    S->Parent[i] = S->Parent[S->Parent[i]];
+    i = S->Parent[i];
+  }
+  return i;
+}
+
+static int LCOMPRESS_Bucket(ShrinkRec *S, int Tail, int Head)
+{
+  unsigned int Key;
+  Key = ((unsigned int)Tail * 2654435761u) ^
+        ((unsigned int)Head * 2246822519u);
+  return (int)((Key ^ (Key >> 15)) & (unsigned int)S->HashMask);
+}
+
+/* Entry of the roots i and j, 0 if none. */
+static int LCOMPRESS_FindEntry(ShrinkRec *S, int i, int j)
+{
+  int e,Tail,Head;
+
+  Tail = (i < j) ? i : j;
+  Head = (i < j) ? j : i;
+
+  for (e=S->HashFirst[LCOMPRESS_Bucket(S,Tail,Head)]; e>0; e=S->EntryNext[e])
+  {
+    if ((S->EntryTail[e] == Tail) && (S->EntryHead[e] == Head)) return e;
+  }
+  return 0;
+}
+
+static double LCOMPRESS_GetX(ShrinkRec *S, int i, int j)
+{
+  int e;
+  e = LCOMPRESS_FindEntry(S,i,j);
+  return (e > 0) ? S->EntryX[e] : 0.0;
+}
+
+static void LCOMPRESS_AddX(ShrinkRec *S, int i, int j, double X)
+{
+  int e,b,Tail,Head;
+
+  e = LCOMPRESS_FindEntry(S,i,j);
+  if (e > 0)
+  {
+    S->EntryX[e] += X;
+    return;
+  }
+
+  Tail = (i < j) ? i : j;
+  Head = (i < j) ? j : i;
+
+  if (S->FreeEntry > 0)
+  {
+    e = S->FreeEntry;
+    S->FreeEntry = S->EntryNext[e];
+  }
+  else
+  {
+    e = ++(S->NoOfEntries);
+  }
+
+  b = LCOMPRESS_Bucket(S,Tail,Head);
+  S->EntryTail[e] = Tail;
+  S->EntryHead[e] = Head;
+  S->EntryX[e] = X;
+  S->EntryNext[e] = S->HashFirst[b];
+  S->HashFirst[b] = e;
+}
+
+/* Removes the entry of the roots i and j and returns its x-sum. */
+static double LCOMPRESS_RemoveX(ShrinkRec *S, int i, int j)
+{
+  int e,Prev,b,Tail,Head;
+  double X;
+
+  Tail = (i < j) ? i : j;
+  Head = (i < j) ? j : i;
+  b = LCOMPRESS_Bucket(S,Tail,Head);
+
+  Prev = 0;
+  for (e=S->HashFirst[b]; e>0; e=S->EntryNext[e])
+  {
+    if ((S->EntryTail[e] == Tail) && (S->EntryHead[e] == Head)) break;
+    Prev = e;
+  }
+
+  if (e == 0) return 0.0;
+
+  if (Prev > 0)
+  S->EntryNext[Prev] = S->EntryNext[e];
+  else
+  S->HashFirst[b] = S->EntryNext[e];
+
+  X = S->EntryX[e];
+  S->EntryNext[e] = S->FreeEntry;
+  S->FreeEntry = e;
+
+  return X;
+}
+
+static void LCOMPRESS_Union(ShrinkRec *S, int i, int j)
+{
+  int a,c,Small,Large;
+
+  i = LCOMPRESS_Find(S,i);
+  j = LCOMPRESS_Find(S,j);
+  if (i == j) return;
+
+  if (S->ListSize[i] < S->ListSize[j])
+  {
+    Small = i;
+    Large = j;
+  }
+  else
+  {
+    Small = j;
+    Large = i;
+  }
+
+  S->MarkNr++;
+  for (a=S->FirstArc[Small]; a>0; a=S->NextArc[a])
+  {
+    c = LCOMPRESS_Find(S,S->ArcHead[a]);
+    if ((c == Small) || (S->Mark[c] == S->MarkNr)) continue;
+    S->Mark[c] = S->MarkNr;
+
+    if (c == Large)
+    S->Diag[Large] += LCOMPRESS_RemoveX(S,Small,c);
+    else
+    LCOMPRESS_AddX(S,Large,c,LCOMPRESS_RemoveX(S,Small,c));
+  }
+
+  S->Diag[Large] += S->Diag[Small];
+  S->Size[Large] += S->Size[Small];
+
+  if (S->FirstArc[Small] > 0)
+  {
+    if (S->FirstArc[Large] > 0)
+    S->NextArc[S->LastArc[Large]] = S->FirstArc[Small];
+    else
+    S->FirstArc[Large] = S->FirstArc[Small];
+    S->LastArc[Large] = S->LastArc[Small];
+  }
+  S->ListSize[Large] += S->ListSize[Small];
+
+  S->Parent[Small] = Large;
+}
+
+/* Roots adjacent to the root i (each once), in NbList[1..*NbListSize]. */
+static void LCOMPRESS_Neighbours(ShrinkRec *S, int i,
+                                 int *NbList, int *NbListSize)
+{
+  int a,c;
+
+  *NbListSize = 0;
+  S->MarkNr++;
+  for (a=S->FirstArc[i]; a>0; a=S->NextArc[a])
+  {
+    c = LCOMPRESS_Find(S,S->ArcHead[a]);
+    if ((c == i) || (S->Mark[c] == S->MarkNr)) continue;
+    S->Mark[c] = S->MarkNr;
+    NbList[++(*NbListSize)] = c;
+  }
+}
+
+void COMPRESS_ShrinkGraph(CSRGraphPtr SupportPtr,
                           int NoOfCustomers,
-                          double **XMatrix,
-                          double **SMatrix,
+                          SparseMatrixPtr XMatrix,
+                          SparseMatrixPtr SMatrix,
                           int NoOfV1Cuts,
                           ReachPtr V1CutsPtr,
-                          ReachPtr SAdjRPtr, /* Shrunk support graph */
+                          CSRGraphPtr *SAdjPtr, /* Shrunk support graph */
                           ReachPtr SuperNodesRPtr, /* Nodes in supernodes */
                           int *ShrunkGraphCustNodes) /* Excl. depot */
 {
   char NewLinks,TolerantShrinking,ShrinkableSet;
   int i,j,k,Tail,Head;
-  int NoOfComponents,NodeListSize;
+  int IJ,IK;
+  int NoOfComponents;
   int CompListSize;
+  int NbListSize,NoOfLinks;
+  int HashDim;
   double EdgeEps,TripleEps,XVal;
   double MaxEdge;
   double Slack;
   double MaxShrinkTolerance,UsedTolerance;
 
-  char *CVWrk1;
-  int *IVWrk1, *IVWrk2, *IVWrk3, *IVWrk4;
-
   char *Shrinkable;
   int *CompNr; /* Node j is in component nr. CompNr[j]. */
+  int *CompRoot; /* Root of the supernode of component nr. i */
+  int *RootComp; /* Component nr. of the root i */
   int *NodeList;
   int *CompList;
+  int *NbList;
+  int *LinkTail, *LinkHead;
 
-  ReachPtr CmprsEdgesRPtr;
-  ReachPtr CompsRPtr;
+  ShrinkRec S;
+  CSRGraphPtr SAdj;
 
   EdgeEps = 0.999; /* Shrink any edge >= Eps. */
   TripleEps = 1.999;
@@ -92,140 +295,188 @@ void COMPRESS_ShrinkGraph(ReachPtr SupportPtr,
   MaxShrinkTolerance = 0.01;
   UsedTolerance = 0.0;
 
-  CVWrk1 = MemGetCV(NoOfCustomers+1);
-
-  IVWrk1 = MemGetIV(NoOfCustomers+1);
-  IVWrk2 = MemGetIV(NoOfCustomers+1);
-  IVWrk3 = MemGetIV(NoOfCustomers+1);
-  IVWrk4 = MemGetIV(NoOfCustomers+1);
-
   Shrinkable = MemGetCV(NoOfCustomers+1);
 
   CompNr = MemGetIV(NoOfCustomers+2);
-  NodeList = MemGetIV(NoOfCustomers+1);
+  CompRoot = MemGetIV(NoOfCustomers+2);
+  RootComp = MemGetIV(NoOfCustomers+2);
+  NodeList = MemGetIV(NoOfCustomers+2);
   CompList = MemGetIV(NoOfCustomers+1);
+  NbList = MemGetIV(NoOfCustomers+2);
+  LinkTail = MemGetIV(SupportPtr->NoOfArcs+1);
+  LinkHead = MemGetIV(SupportPtr->NoOfArcs+1);
+
+  S.Parent = MemGetIV(NoOfCustomers+2);
+  S.Size = MemGetIV(NoOfCustomers+2);
+  S.Diag = MemGetDV(NoOfCustomers+2);
+  S.FirstArc = MemGetIV(NoOfCustomers+2);
+  S.LastArc = MemGetIV(NoOfCustomers+2);
+  S.ListSize = MemGetIV(NoOfCustomers+2);
+  S.NextArc = MemGetIV(SupportPtr->NoOfArcs+1);
+  S.ArcHead = MemGetIV(SupportPtr->NoOfArcs+1);
+  S.Mark = MemGetIV(NoOfCustomers+2);
+  S.MarkNr = 0;
+
+  /* There are never more entries than edges. */
+  HashDim = 1;
+  while (HashDim < SupportPtr->NoOfArcs) HashDim *= 2;
+  S.HashMask = HashDim - 1;
+  S.HashFirst = MemGetIV(HashDim);
+  S.EntryNext = MemGetIV(SupportPtr->NoOfArcs+1);
+  S.EntryTail = MemGetIV(SupportPtr->NoOfArcs+1);
+  S.EntryHead = MemGetIV(SupportPtr->NoOfArcs+1);
+  S.EntryX = MemGetDV(SupportPtr->NoOfArcs+1);
+  S.NoOfEntries = 0;
+  S.FreeEntry = 0;
+
+  for (i=0; i<HashDim; i++) S.HashFirst[i] = 0;
+
+  for (i=1; i<=NoOfCustomers+1; i++)
+  {
+    S.Parent[i] = i;
+    S.Size[i] = 1;
+    S.Diag[i] = 0.0;
+    S.Mark[i] = 0;
+
+    S.FirstArc[i] = 0;
+    S.LastArc[i] = 0;
+    S.ListSize[i] = 0;
+    for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
+    {
+      S.ArcHead[k] = SupportPtr->ArcHead[k];
+      S.NextArc[k] = 0;
+      if (S.FirstArc[i] == 0)
+      S.FirstArc[i] = k;
+      else
+      S.NextArc[S.LastArc[i]] = k;
+      S.LastArc[i] = k;
+      S.ListSize[i]++;
+    }
+  }
 
-  ReachInitMem(&CmprsEdgesRPtr,NoOfCustomers+1);
-  ReachInitMem(&CompsRPtr,NoOfCustomers+1);
+  for (i=1; i<=NoOfCustomers; i++)
+  {
+    for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
+    {
+      j = SupportPtr->ArcHead[k];
+      if (j > i)
+      LCOMPRESS_AddX(&S,i,j,SPM_Get(XMatrix,i,j));
+    }
+  }
 
   for (i=1; i<NoOfCustomers; i++)
   {
-    for (k=1; k<=SupportPtr->LP[i].CFN; k++)
+    for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
     {
-      j = SupportPtr->LP[i].FAL[k];
+      j = SupportPtr->ArcHead[k];
       if ((j <= NoOfCustomers) && (j > i))
-      if (XMatrix[i][j] >= EdgeEps)
-      {
-        ReachAddForwArc(CmprsEdgesRPtr,i,j);
-        ReachAddForwArc(CmprsEdgesRPtr,j,i);
-      }
+      if (SPM_Get(XMatrix,i,j) >= EdgeEps)
+      LCOMPRESS_Union(&S,i,j);
     }
   }
 
   do
   {
-    ReachClearForwLists(CompsRPtr);
+    /* Components are numbered by their smallest node (as the strong
+       components of the compressed edges were). */
 
-    ComputeStrongComponents(CmprsEdgesRPtr,CompsRPtr,
-                            &NoOfComponents,NoOfCustomers,
-                            CVWrk1,
-                            IVWrk1,IVWrk2,IVWrk3,IVWrk4);
+    NoOfComponents = 0;
+    for (i=1; i<=NoOfCustomers; i++) RootComp[i] = 0;
 
-    for (i=1; i<=NoOfComponents; i++)
+    for (i=1; i<=NoOfCustomers; i++)
     {
-      for (k=1; k<=CompsRPtr->LP[i].CFN; k++)
+      j = LCOMPRESS_Find(&S,i);
+      if (RootComp[j] == 0)
       {
-        j = CompsRPtr->LP[i].FAL[k];
-        CompNr[j] = i;
+        RootComp[j] = ++NoOfComponents;
+        CompRoot[NoOfComponents] = j;
       }
+      CompNr[i] = RootComp[j];
     }
 
-    CompNr[NoOfCustomers+1] = NoOfComponents+1; /* Depot in last comp. */
-
-    for (i=1; i<=NoOfComponents+1; i++)
-    for (j=1; j<=NoOfComponents+1; j++)
-    SMatrix[i][j] = 0.0;
-
-    for (i=1; i<=NoOfCustomers; i++) /* i = NoOfCustomers is ok, */
-    {                                /* j may be the depot. */
-      for (k=1; k<=SupportPtr->LP[i].CFN; k++)
-      {
-        j = SupportPtr->LP[i].FAL[k];
-        if (j > i)
-        {
-          XVal = XMatrix[i][j];
-          SMatrix[CompNr[i]][CompNr[j]] += XVal;
-
-          if (CompNr[i] != CompNr[j])
-          SMatrix[CompNr[j]][CompNr[i]] += XVal;
-        }
-      }
-    }
+    /* Depot in last comp. */
+    CompNr[NoOfCustomers+1] = NoOfComponents+1;
+    RootComp[NoOfCustomers+1] = NoOfComponents+1;
+    CompRoot[NoOfComponents+1] = NoOfCustomers+1;
 
     for (i=1; i<=NoOfComponents; i++)
     {
-      if (SMatrix[i][i] < (CompsRPtr->LP[i].CFN - 1 + 0.01))
+      j = CompRoot[i];
+      if (S.Diag[j] < (S.Size[j] - 1 + 0.01))
       Shrinkable[i] = 1;
       else
       Shrinkable[i] = 0;
     }
 
-    /* Check for new possible compressions. */
+    /* Check for new possible compressions. The links of this pass are
+       merged after the scan. */
 
     NewLinks = 0;
+    NoOfLinks = 0;
 
     for (i=1; i<NoOfComponents; i++)
     {
       if (Shrinkable[i] == 0) continue;
 
-      for (j=i+1; j<=NoOfComponents; j++)
+      LCOMPRESS_Neighbours(&S,CompRoot[i],NbList,&NbListSize);
+      for (IJ=1; IJ<=NbListSize; IJ++)
       {
+        j = RootComp[NbList[IJ]];
+        if ((j <= i) || (j > NoOfComponents)) continue;
         if (Shrinkable[j] == 0) continue;
 
-        if (SMatrix[i][j] >= EdgeEps)
+        if (LCOMPRESS_GetX(&S,CompRoot[i],CompRoot[j]) >= EdgeEps)
         {
-          Tail = CompsRPtr->LP[i].FAL[1];
-          Head = CompsRPtr->LP[j].FAL[1];
-
-          ReachAddForwArc(CmprsEdgesRPtr,Tail,Head);
-          ReachAddForwArc(CmprsEdgesRPtr,Head,Tail);
+          NoOfLinks++;
+          LinkTail[NoOfLinks] = CompRoot[i];
+          LinkHead[NoOfLinks] = CompRoot[j];
           NewLinks = 1;
         }
       }
     }
 
+    for (i=1; i<=NoOfLinks; i++)
+    LCOMPRESS_Union(&S,LinkTail[i],LinkHead[i]);
+
     if (NewLinks == 0)
     {
-      /* (check triplets) */
+      /* (check triplets: the neighbours of i in increasing order) */
       for (i=1; i<NoOfComponents; i++)
       {
         if (Shrinkable[i] == 0) continue;
 
-        for (j=i+1; j<NoOfComponents; j++)
+        LCOMPRESS_Neighbours(&S,CompRoot[i],NbList,&NbListSize);
+
+        k = 0;
+        for (IJ=1; IJ<=NbListSize; IJ++)
         {
+          j = RootComp[NbList[IJ]];
+          if ((j <= i) || (j > NoOfComponents)) continue;
           if (Shrinkable[j] == 0) continue;
-          if (SMatrix[i][j] <= 0.01) continue;
+          if (LCOMPRESS_GetX(&S,CompRoot[i],CompRoot[j]) <= 0.01) continue;
+          NbList[++k] = j;
+        }
+        NbListSize = k;
+
+        if (NbListSize > 1) SortIVInc(NbList,NbListSize);
+
+        for (IJ=1; IJ<NbListSize; IJ++)
+        {
+          j = NbList[IJ];
 
-          for (k=j+1; k<=NoOfComponents; k++)
+          for (IK=IJ+1; IK<=NbListSize; IK++)
           {
-            if (Shrinkable[k] == 0) continue;
-            if (SMatrix[i][k] <= 0.01) continue;
-            if (SMatrix[j][k] <= 0.01) continue;
+            k = NbList[IK];
+            XVal = LCOMPRESS_GetX(&S,CompRoot[j],CompRoot[k]);
+            if (XVal <= 0.01) continue;
 
-            XVal = SMatrix[i][j] + SMatrix[i][k] + SMatrix[j][k];
+            XVal = LCOMPRESS_GetX(&S,CompRoot[i],CompRoot[j]) +
+                   LCOMPRESS_GetX(&S,CompRoot[i],CompRoot[k]) + XVal;
 
             if (XVal >= TripleEps)
             {
-              Tail = CompsRPtr->LP[i].FAL[1];
-              Head = CompsRPtr->LP[j].FAL[1];
-
-              ReachAddForwArc(CmprsEdgesRPtr,Tail,Head);
-              ReachAddForwArc(CmprsEdgesRPtr,Head,Tail);
-
-              Head = CompsRPtr->LP[k].FAL[1];
-
-              ReachAddForwArc(CmprsEdgesRPtr,Tail,Head);
-              ReachAddForwArc(CmprsEdgesRPtr,Head,Tail);
+              LCOMPRESS_Union(&S,CompRoot[i],CompRoot[j]);
+              LCOMPRESS_Union(&S,CompRoot[i],CompRoot[k]);
 
               NewLinks = 1;
               goto EndOfTriplets;
@@ -244,17 +495,26 @@ void COMPRESS_ShrinkGraph(ReachPtr SupportPtr,
         (TolerantShrinking) &&
         (UsedTolerance < MaxShrinkTolerance))
     {
+      /* (the first maximum edge in the order of the components) */
       Tail = 0;
       Head = 0;
       MaxEdge = 0.0;
       for (i=1; i<NoOfComponents; i++)
-      for (j=i+1; j<=NoOfComponents; j++)
       {
-        if (SMatrix[i][j] > MaxEdge)
+        LCOMPRESS_Neighbours(&S,CompRoot[i],NbList,&NbListSize);
+        for (IJ=1; IJ<=NbListSize; IJ++)
         {
-          MaxEdge = SMatrix[i][j];
-          Tail = i;
-          Head = j;
+          j = RootComp[NbList[IJ]];
+          if ((j <= i) || (j > NoOfComponents)) continue;
+
+          XVal = LCOMPRESS_GetX(&S,CompRoot[i],CompRoot[j]);
+          if ((XVal > MaxEdge) ||
+              ((XVal == MaxEdge) && (Tail == i) && (j < Head)))
+          {
+            MaxEdge = XVal;
+            Tail = i;
+            Head = j;
+          }
         }
       }
 
@@ -263,14 +523,7 @@ void COMPRESS_ShrinkGraph(ReachPtr SupportPtr,
       {
         NewLinks = 1;
 
-        i = Tail;
-        j = Head;
-
-        Tail = CompsRPtr->LP[i].FAL[1];
-        Head = CompsRPtr->LP[j].FAL[1];
-
-        ReachAddForwArc(CmprsEdgesRPtr,Tail,Head);
-        ReachAddForwArc(CmprsEdgesRPtr,Head,Tail);
+        LCOMPRESS_Union(&S,CompRoot[Tail],CompRoot[Head]);
         UsedTolerance += (1.0 - MaxEdge);
       }
     }
@@ -299,14 +552,9 @@ void COMPRESS_ShrinkGraph(ReachPtr SupportPtr,
 
         if ((Slack <= 0.01) && (CompListSize > 1) && (ShrinkableSet))
         {
-          Tail = CompsRPtr->LP[CompList[1]].FAL[1];
-
           for (j=2; j<=CompListSize; j++)
           {
-            Head = CompsRPtr->LP[CompList[j]].FAL[1];
-
-            ReachAddForwArc(CmprsEdgesRPtr,Tail,Head);
-            ReachAddForwArc(CmprsEdgesRPtr,Head,Tail);
+            LCOMPRESS_Union(&S,CompRoot[CompList[1]],CompRoot[CompList[j]]);
           }
 
           NewLinks = 1;
@@ -321,29 +569,68 @@ void COMPRESS_ShrinkGraph(ReachPtr SupportPtr,
 
   } while (NewLinks);
 
+  /* The shrunk graph is built once, from the support graph (the x-sums
+     of the hash table were only needed by the tests above). */
+
+  SPM_Clear(SMatrix,NoOfComponents+1);
+
+  for (i=1; i<=NoOfCustomers; i++) /* i = NoOfCustomers is ok, */
+  {                                /* j may be the depot. */
+    for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
+    {
+      j = SupportPtr->ArcHead[k];
+      if (j > i)
+      {
+        XVal = SPM_Get(XMatrix,i,j);
+        SPM_AddSym(SMatrix,CompNr[i],CompNr[j],XVal);
+      }
+    }
+  }
+
+  SPM_Finish(SMatrix);
+
   /* SuperNode number NoOfComponents+1 is the depot. */
 
+  CSR_InitMem(SAdjPtr,NoOfCustomers+1,SMatrix->NoOfEntries);
+  SAdj = *SAdjPtr;
+
   for (i=1; i<=NoOfComponents+1; i++)
   {
-    NodeListSize = 0;
-    for (j=1; j<=NoOfComponents+1; j++)
+    SAdj->FirstArc[i] = SAdj->NoOfArcs + 1;
+    for (IJ=SMatrix->RowStart[i]; IJ<SMatrix->RowStart[i+1]; IJ++)
     {
-      if (j != i)
-      if (SMatrix[i][j] >= 0.0001)
+      j = SMatrix->Col[IJ];
+      if (SMatrix->Val[IJ] >= 0.0001)
       {
-        NodeList[++NodeListSize] = j;
+        SAdj->ArcHead[++(SAdj->NoOfArcs)] = j;
       }
     }
+  }
+
+  for (i=NoOfComponents+2; i<=NoOfCustomers+2; i++)
+  {
+    SAdj->FirstArc[i] = SAdj->NoOfArcs + 1;
+  }
+
+  /* Nodes of the supernodes in increasing order: supernode i is
+     NodeList[NbList[i]..NbList[i+1]-1]. */
+
+  NbList[1] = 1;
+  for (i=1; i<=NoOfComponents; i++)
+  {
+    NbList[i+1] = NbList[i] + S.Size[CompRoot[i]];
+    CompList[i] = NbList[i];
+  }
 
-    ReachSetForwList(SAdjRPtr,NodeList,i,NodeListSize);
+  for (i=1; i<=NoOfCustomers; i++)
+  {
+    NodeList[CompList[CompNr[i]]++] = i;
   }
 
   for (i=1; i<=NoOfComponents; i++)
   {
-    ReachSetForwList(SuperNodesRPtr,
-                     CompsRPtr->LP[i].FAL,
-                     i,
-                     CompsRPtr->LP[i].CFN);
+    ReachSetForwList(SuperNodesRPtr,NodeList+NbList[i]-1,i,
+                     NbList[i+1]-NbList[i]);
   }
 
   /* Depot: */
@@ -352,20 +639,30 @@ void COMPRESS_ShrinkGraph(ReachPtr SupportPtr,
 
   *ShrunkGraphCustNodes = NoOfComponents;
 
-  MemFree(CVWrk1);
-
-  MemFree(IVWrk1);
-  MemFree(IVWrk2);
-  MemFree(IVWrk3);
-  MemFree(IVWrk4);
+  MemFree(Shrinkable);
 
   MemFree(CompNr);
+  MemFree(CompRoot);
+  MemFree(RootComp);
   MemFree(NodeList);
-
-  MemFree(Shrinkable);
   MemFree(CompList);
-
-  ReachFreeMem(&CmprsEdgesRPtr);
-  ReachFreeMem(&CompsRPtr);
+  MemFree(NbList);
+  MemFree(LinkTail);
+  MemFree(LinkHead);
+
+  MemFree(S.Parent);
+  MemFree(S.Size);
+  MemFree(S.Diag);
+  MemFree(S.FirstArc);
+  MemFree(S.LastArc);
+  MemFree(S.ListSize);
+  MemFree(S.NextArc);
+  MemFree(S.ArcHead);
+  MemFree(S.Mark);
+
+  MemFree(S.HashFirst);
+  MemFree(S.EntryNext);
+  MemFree(S.EntryTail);
+  MemFree(S.EntryHead);
+  MemFree(S.EntryX);
 }
-
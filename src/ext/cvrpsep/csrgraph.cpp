@@ -0,0 +1,112 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: csrgraph.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Compressed sparse row (forward star) graph replacing the ReachPtr
+ * support graphs of the CAPSEP routines.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 18, 2026, 12:20 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "../../../include/ext/cvrpsep/memmod.h"
+#include "../../../include/ext/cvrpsep/csrgraph.h"
+
+void CSR_InitMem(CSRGraphPtr *P, int n, int MaxArcs)
+{
+  int i;
+  char *Block;
+
+  if (MaxArcs < 1) MaxArcs = 1;
+
+  /* Record, FirstArc[0..n+1] and ArcHead[0..MaxArcs] in one block. */
+  Block = (char *) MemGet(sizeof(CSRGraphRec) +
+                          sizeof(int) * (n + 2) +
+                          sizeof(int) * (MaxArcs + 1));
+
+  (*P) = (CSRGraphPtr) Block;
+  (*P)->n = n;
+  (*P)->NoOfArcs = 0;
+  (*P)->FirstArc = (int *) (Block + sizeof(CSRGraphRec));
+  (*P)->ArcHead = (*P)->FirstArc + (n + 2);
+
+  for (i=0; i<=n+1; i++) (*P)->FirstArc[i] = 1;
+}
+
+void CSR_CreateFromEdges(CSRGraphPtr *P, int n, int NoOfEdges,
+                         int *EdgeTail, int *EdgeHead)
+{
+  int i,e,Pos,Degree;
+  int *FirstArc, *ArcHead;
+
+  CSR_InitMem(P,n,2*NoOfEdges);
+  FirstArc = (*P)->FirstArc;
+  ArcHead = (*P)->ArcHead;
+
+  for (i=0; i<=n+1; i++) FirstArc[i] = 0;
+  for (e=1; e<=NoOfEdges; e++)
+  {
+    FirstArc[EdgeTail[e]]++;
+    FirstArc[EdgeHead[e]]++;
+  }
+
+  Pos = 1;
+  for (i=1; i<=n; i++)
+  {
+    Degree = FirstArc[i];
+    FirstArc[i] = Pos;
+    Pos += Degree;
+  }
+  FirstArc[n+1] = Pos;
+
+  /* FirstArc[i] is the next free position of node i while filling, and the
+     first position of node i+1 afterwards. */
+  for (e=1; e<=NoOfEdges; e++)
+  {
+    ArcHead[FirstArc[EdgeTail[e]]++] = EdgeHead[e];
+    ArcHead[FirstArc[EdgeHead[e]]++] = EdgeTail[e];
+  }
+
+  for (i=n; i>=2; i--) FirstArc[i] = FirstArc[i-1];
+  FirstArc[1] = 1;
+
+  (*P)->NoOfArcs = 2 * NoOfEdges;
+}
+
+void CSR_FreeMem(CSRGraphPtr *P)
+{
+  if ((*P) == NULL) return;
+
+  MemFree(*P);
+  (*P) = NULL;
+}
+
+void CSR_Write(CSRGraphPtr P)
+{
+  int i,a;
+
+  if (P == NULL)
+  {
+    printf("CSRGraphPtr==NULL\n");
+    return;
+  }
+
+  printf("CSRGraphPtr (P->n = %d, P->NoOfArcs = %d):\n",P->n,P->NoOfArcs);
+  for (i=1; i<=P->n; i++)
+  {
+    if (P->FirstArc[i+1] == P->FirstArc[i]) continue;
+
+    printf("%2d (%2d) ->",i,P->FirstArc[i+1]-P->FirstArc[i]);
+    for (a=P->FirstArc[i]; a<P->FirstArc[i+1]; a++)
+    printf(" %d",P->ArcHead[a]);
+    printf("\n");
+  }
+}
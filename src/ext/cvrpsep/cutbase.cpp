@@ -7,13 +7,15 @@
 
 #include "../../../include/ext/cvrpsep/memmod.h"
 #include "../../../include/ext/cvrpsep/basegrph.h"
+#include "../../../include/ext/cvrpsep/csrgraph.h"
+#include "../../../include/ext/cvrpsep/spmatrix.h"
 #include "../../../include/ext/cvrpsep/cutbase.h"
 
-void CUTBASE_CompXSumInSet(ReachPtr SupportPtr,
+void CUTBASE_CompXSumInSet(CSRGraphPtr SupportPtr,
                            int NoOfCustomers,
                            char *InNodeSet,
                            int *NodeList, int NodeListSize,
-                           double **XMatrix,
+                           SparseMatrixPtr XMatrix,
                            double *XSumInSet)
 {
   char *InSet;
@@ -39,12 +41,12 @@ void CUTBASE_CompXSumInSet(ReachPtr SupportPtr,
   {
     if (InSet[i] == 0) continue;
 
-    for (k=1; k<=SupportPtr->LP[i].CFN; k++)
+    for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
     {
-      j = SupportPtr->LP[i].FAL[k];
+      j = SupportPtr->ArcHead[k];
       if ((j > i) && (j <= NoOfCustomers)) /* Only one of (i,j) and (j,i) */
       if (InSet[j])
-      XSum += XMatrix[i][j];
+      XSum += SPM_Get(XMatrix,i,j);
     }
   }
 
@@ -90,12 +92,12 @@ void CUTBASE_CompVehiclesForSet(int NoOfCustomers,
   }
 }
 
-void CUTBASE_CompCapViolation(ReachPtr SupportPtr,
+void CUTBASE_CompCapViolation(CSRGraphPtr SupportPtr,
                               int NoOfCustomers,
                               char *NodeInSet,
                               int *NodeList, int NodeListSize,
                               int *Demand, int CAP,
-                              double **XMatrix,
+                              SparseMatrixPtr XMatrix,
                               double *Violation)
 {
   int i,MinV,SetSize;
@@ -7,6 +7,8 @@
 
 #include "../../../include/ext/cvrpsep/memmod.h"
 #include "../../../include/ext/cvrpsep/basegrph.h"
+#include "../../../include/ext/cvrpsep/csrgraph.h"
+#include "../../../include/ext/cvrpsep/spmatrix.h"
 #include "../../../include/ext/cvrpsep/cutbase.h"
 #include "../../../include/ext/cvrpsep/mxf.h"
 
@@ -98,9 +100,9 @@ void FCAPFIX_CompSourceFixNodes(ReachPtr HistoryPtr,
   MemFree(FixedOutNode);
 }
 
-void FCAPFIX_CompAddSinkNode(ReachPtr SupportPtr,
+void FCAPFIX_CompAddSinkNode(CSRGraphPtr SupportPtr,
                              int NoOfCustomers,
-                             double **XMatrix,
+                             SparseMatrixPtr XMatrix,
                              int SeedNode,
                              int *AddNodeToSinkSide,
                              int *SourceList,
@@ -122,14 +124,15 @@ void FCAPFIX_CompAddSinkNode(ReachPtr SupportPtr,
   *AddNodeToSinkSide = 0;
   BestXScore = 0.0;
 
-  for (i=1; i<=SupportPtr->LP[SeedNode].CFN; i++)
+  for (i=SupportPtr->FirstArc[SeedNode];
+       i<SupportPtr->FirstArc[SeedNode+1]; i++)
   {
-    j = SupportPtr->LP[SeedNode].FAL[i];
+    j = SupportPtr->ArcHead[i];
     if (j > NoOfCustomers) continue;
 
     if (OnSourceSide[j] == 0)
     {
-      XScore = XMatrix[SeedNode][j];
+      XScore = SPM_Get(XMatrix,SeedNode,j);
       if ((*AddNodeToSinkSide == 0) || (XScore > BestXScore))
       {
         *AddNodeToSinkSide = j;
@@ -193,10 +196,10 @@ void FCAPFIX_SolveMaxFlow(MaxFlowPtr MXFPtr,
   }
 }
 
-void FCAPFIX_CheckExpandSet(ReachPtr SupportPtr,
+void FCAPFIX_CheckExpandSet(CSRGraphPtr SupportPtr,
                             int NoOfCustomers,
                             int *Demand, int CAP,
-                            double **XMatrix,
+                            SparseMatrixPtr XMatrix,
                             char *NodeInSet,
                             char *FixedOut,
                             int *AddNode,
@@ -213,12 +216,12 @@ void FCAPFIX_CheckExpandSet(ReachPtr SupportPtr,
   XSumInSet = 0.0;
   for (i=1; i<=NoOfCustomers; i++)
   {
-    for (k=1; k<=SupportPtr->LP[i].CFN; k++)
+    for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
     {
-      j = SupportPtr->LP[i].FAL[k];
+      j = SupportPtr->ArcHead[k];
       if ((j <= NoOfCustomers) && (j > i))
       {
-        XVal = XMatrix[i][j];
+        XVal = SPM_Get(XMatrix,i,j);
         if (NodeInSet[i]) XNodeSum[j] += XVal;
         if (NodeInSet[j]) XNodeSum[i] += XVal;
         if ((NodeInSet[i]) && (NodeInSet[j])) XSumInSet += XVal;
@@ -247,9 +250,9 @@ void FCAPFIX_CheckExpandSet(ReachPtr SupportPtr,
   {
     if (NodeInSet[i] == 0) continue;
 
-    for (k=1; k<=SupportPtr->LP[i].CFN; k++)
+    for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
     {
-      j = SupportPtr->LP[i].FAL[k];
+      j = SupportPtr->ArcHead[k];
       if ((j <= NoOfCustomers) &&
           (NodeInSet[j] == 0) &&
           (FixedOut[j] == 0) &&
@@ -273,11 +276,11 @@ void FCAPFIX_CheckExpandSet(ReachPtr SupportPtr,
 }
 
 
-void FCAPFIX_ComputeCuts(ReachPtr SupportPtr,
+void FCAPFIX_ComputeCuts(CSRGraphPtr SupportPtr,
                          int NoOfCustomers,
                          int *Demand, int CAP,
                          int *SuperNodeSize,
-                         double **XMatrix,
+                         SparseMatrixPtr XMatrix,
                          int MaxCuts,
                          int MaxRounds,
                          int *NoOfGeneratedCuts,
@@ -355,12 +358,12 @@ void FCAPFIX_ComputeCuts(ReachPtr SupportPtr,
 
   for (i=1; i<=NoOfCustomers; i++)
   {
-    for (j=1; j<=SupportPtr->LP[i].CFN; j++)
+    for (j=SupportPtr->FirstArc[i]; j<SupportPtr->FirstArc[i+1]; j++)
     {
-      k = SupportPtr->LP[i].FAL[j];
+      k = SupportPtr->ArcHead[j];
       if ((k <= NoOfCustomers) && (k > i))
       {
-        XVal = XMatrix[i][k];
+        XVal = SPM_Get(XMatrix,i,k);
         XVal *= VCAP;
         ArcCap = XVal + 1; /* => Round up. */
 
@@ -374,10 +377,11 @@ void FCAPFIX_ComputeCuts(ReachPtr SupportPtr,
 
   for (k=1; k<=NoOfCustomers; k++) DepotEdgeXVal[k] = 0.0;
 
-  for (j=1; j<=SupportPtr->LP[DepotIdx].CFN; j++)
+  for (j=SupportPtr->FirstArc[DepotIdx];
+       j<SupportPtr->FirstArc[DepotIdx+1]; j++)
   {
-    k = SupportPtr->LP[DepotIdx].FAL[j];
-    DepotEdgeXVal[k] = XMatrix[DepotIdx][k];
+    k = SupportPtr->ArcHead[j];
+    DepotEdgeXVal[k] = SPM_Get(XMatrix,DepotIdx,k);
   }
 
   InfCap = 0;
@@ -588,7 +592,7 @@ void FCAPFIX_ComputeCuts(ReachPtr SupportPtr,
         DemandSum += Demand[j];
 
         if (SuperNodeSize[j] > 1)
-        XInSet += XMatrix[j][j];
+        XInSet += SPM_Get(XMatrix,j,j);
       }
 
       CAPSum = CAP;
@@ -7,10 +7,22 @@
 
 #include "../../../include/ext/cvrpsep/memmod.h"
 #include "../../../include/ext/cvrpsep/basegrph.h"
+#include "../../../include/ext/cvrpsep/csrgraph.h"
+#include "../../../include/ext/cvrpsep/spmatrix.h"
 #include "../../../include/ext/cvrpsep/sort.h"
 #include "../../../include/ext/cvrpsep/cnstrmgr.h"
 #include "../../../include/ext/cvrpsep/cutbase.h"
 
+/* GRSEARCH_PREFIX_TABLE selects how GRSEARCH_CapCuts finds the anti-sets
+   that forbid a candidate: 1 scans a table of the node sums and keys of
+   their prefixes (up to GRSEARCH_MAX_TABLE_DIM entries, else as 0), 0 tests
+   all anti-sets with GRSEARCH_GetInfeasExt. Both label the same nodes. */
+#ifndef GRSEARCH_PREFIX_TABLE
+#define GRSEARCH_PREFIX_TABLE 1
+#endif
+
+#define GRSEARCH_MAX_TABLE_DIM (1 << 21)
+
 void GRSEARCH_SwapNodesInPos(int *Node, int *Pos, int s, int t)
 {
   /* s,t are the indices in the Node vector. */
@@ -60,6 +72,92 @@ void GRSEARCH_AddSet(ReachPtr RPtr,
   MemFree(SumList);
 }
 
+static void LGRSEARCH_CheckInfeasExt(int *Pos,
+                                     int MinCandidateIdx,
+                                     int MaxCandidateIdx,
+                                     int NoOfCustomers,
+                                     int NodeSum,
+                                     ReachPtr RPtr,
+                                     int SetNr,
+                                     int *NodeLabel,
+                                     int Label,
+                                     char *CallBack)
+{
+  /* The test of anti-set SetNr in GRSEARCH_GetInfeasExt. */
+  int i,j,Sum,DiffNode,NotMatchingNode;
+
+  if (RPtr->LP[SetNr].CFN < MinCandidateIdx)
+  {
+    /* For a possible extension, the set must contain at least */
+    /* one more node than the actual set. */
+    return;
+  }
+
+  if (RPtr->LP[SetNr].CBN < RPtr->LP[SetNr].CFN)
+  {
+    /* Only the full set is prohibited. */
+    /* BAL[1] contains the node sum. */
+    if (RPtr->LP[SetNr].CFN != MinCandidateIdx)
+    {
+      if (RPtr->LP[SetNr].CFN > MinCandidateIdx) *CallBack = 1;
+      return;
+    }
+    Sum = RPtr->LP[SetNr].BAL[1];
+  }
+  else
+  {
+    /* BAL contains the cumulative sum */
+    Sum = RPtr->LP[SetNr].BAL[MinCandidateIdx];
+    if (RPtr->LP[SetNr].BAL[RPtr->LP[SetNr].CBN] > NodeSum)
+    {
+      /* The sum of all nodes in set SetNr exceeds NodeSum, so
+         later it could be necessary to check set SetNr. */
+      *CallBack = 1;
+    }
+  }
+
+  DiffNode = Sum - NodeSum;
+  /* return if the same sum could not be obtained by adding one node. */
+
+  if (DiffNode < 1) return; /* NodeSum >= Sum. */
+  if (DiffNode > NoOfCustomers) return;
+
+  if ((Pos[DiffNode] < MinCandidateIdx) ||
+      (Pos[DiffNode] > MaxCandidateIdx)) return; /* not a candidate. */
+  /* Diffnode is the only possible node that could be infeasible. */
+
+  NotMatchingNode = 0;
+  for (i=1; i<=MinCandidateIdx; i++)
+  {
+    j = RPtr->LP[SetNr].FAL[i];
+
+    if (Pos[j] > MaxCandidateIdx)
+    {
+      /* j is not a candidate, and it is not in the set,
+         so we could not generate this set. */
+      NotMatchingNode = 0;
+      break;
+    }
+    else
+    if (Pos[j] >= MinCandidateIdx)
+    {
+      /* j is a candidate. */
+      if (NotMatchingNode == 0)
+      NotMatchingNode = j;
+      else
+      {
+        NotMatchingNode = 0;
+        break; /* At least two nodes are not in the actual set. */
+      }
+    }
+  }
+
+  if (NotMatchingNode > 0)
+  {
+    NodeLabel[NotMatchingNode] = Label;
+  }
+}
+
 void GRSEARCH_GetInfeasExt(int *Pos,
                            int MinCandidateIdx, int MaxCandidateIdx,
                            int NoOfCustomers,
@@ -72,85 +170,112 @@ void GRSEARCH_GetInfeasExt(int *Pos,
 {
   /* The actual set to be extended is assumed to contain
      MinCandidateIdx-1 nodes (in Node[1]...Node[MinCandidateIdx-1]). */
-  int i,j,SetNr,Sum,DiffNode,NotMatchingNode;
+  int SetNr;
 
   *CallBack = 0;
 
   for (SetNr=1; SetNr<=RPtrSize; SetNr++)
   {
-    if (RPtr->LP[SetNr].CFN < MinCandidateIdx)
-    {
-      /* For a possible extension, the set must contain at least */
-      /* one more node than the actual set. */
-      continue;
-    }
+    LGRSEARCH_CheckInfeasExt(Pos,MinCandidateIdx,MaxCandidateIdx,
+                             NoOfCustomers,NodeSum,RPtr,SetNr,
+                             NodeLabel,Label,CallBack);
+  }
+}
 
-    if (RPtr->LP[SetNr].CBN < RPtr->LP[SetNr].CFN)
-    {
-      /* Only the full set is prohibited. */
-      /* BAL[1] contains the node sum. */
-      if (RPtr->LP[SetNr].CFN != MinCandidateIdx)
-      {
-        if (RPtr->LP[SetNr].CFN > MinCandidateIdx) *CallBack = 1;
-        continue;
-      }
-      Sum = RPtr->LP[SetNr].BAL[1];
-    }
-    else
-    {
-      /* BAL contains the cumulative sum */
-      Sum = RPtr->LP[SetNr].BAL[MinCandidateIdx];
-      if (RPtr->LP[SetNr].BAL[RPtr->LP[SetNr].CBN] > NodeSum)
-      {
-        /* The sum of all nodes in set SetNr exceeds NodeSum, so
-           later it could be necessary to check set SetNr. */
-        *CallBack = 1;
-      }
-    }
+#if GRSEARCH_PREFIX_TABLE
 
-    DiffNode = Sum - NodeSum;
-    /* continue if the same sum could not be obtained by adding one node. */
+/* Prefixes of the anti-sets of GRSEARCH_CapCuts that GRSEARCH_GetInfeasExt
+   compares with the actual set plus one candidate: the prefixes of 2..CFN
+   nodes, or only the full set (CBN < CFN). Row m holds, for each anti-set,
+   the node sum and the key (xor of the node keys) of its prefix of m nodes,
+   or 0 if it has none; a step of the search scans one row. */
+typedef struct
+{
+  int Rows; /* m = 0..Rows-1 */
+  int Stride; /* Anti-sets 1..Stride-1 */
+  int *Sum; /* Sum[m * Stride + SetNr] */
+  unsigned int *Key;
+  unsigned int *NodeKey; /* NodeKey[1..NoOfCustomers] */
+} PrefixTableRec;
+
+/* Pseudo-random key of node j (splitmix64, high half). */
+static unsigned int LGRSEARCH_NodeKey(int j)
+{
+  unsigned long long z;
+  z = (unsigned long long)j * 0x9E3779B97F4A7C15ull;
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return (unsigned int)((z ^ (z >> 31)) >> 32);
+}
 
-    if (DiffNode < 1) continue; /* NodeSum >= Sum. */
-    if (DiffNode > NoOfCustomers) continue;
+static void LGRSEARCH_TableAddSet(PrefixTableRec *T,
+                                  ReachPtr RPtr,
+                                  int SetNr)
+{
+  int m,Size;
+  char FullSetOnly;
+  unsigned int Key;
 
-    if ((Pos[DiffNode] < MinCandidateIdx) ||
-        (Pos[DiffNode] > MaxCandidateIdx)) continue; /* not a candidate. */
-    /* Diffnode is the only possible node that could be infeasible. */
+  Size = RPtr->LP[SetNr].CFN;
+  FullSetOnly = (RPtr->LP[SetNr].CBN < Size);
 
-    NotMatchingNode = 0;
-    for (i=1; i<=MinCandidateIdx; i++)
-    {
-      j = RPtr->LP[SetNr].FAL[i];
+  for (m=0; m<T->Rows; m++)
+  {
+    T->Sum[m * T->Stride + SetNr] = 0;
+    T->Key[m * T->Stride + SetNr] = 0;
+  }
 
-      if (Pos[j] > MaxCandidateIdx)
-      {
-        /* j is not a candidate, and it is not in the set,
-           so we could not generate this set. */
-        NotMatchingNode = 0;
-        break;
-      }
-      else
-      if (Pos[j] >= MinCandidateIdx)
-      {
-        /* j is a candidate. */
-        if (NotMatchingNode == 0)
-        NotMatchingNode = j;
-        else
-        {
-          NotMatchingNode = 0;
-          break; /* At least two nodes are not in the actual set. */
-        }
-      }
-    }
+  Key = 0;
+  for (m=1; (m<=Size) && (m<T->Rows); m++)
+  {
+    Key ^= T->NodeKey[RPtr->LP[SetNr].FAL[m]];
 
-    if (NotMatchingNode > 0)
-    {
-      NodeLabel[NotMatchingNode] = Label;
-    }
+    if ((FullSetOnly) && (m < Size)) continue;
+
+    /* (the sums are those tested by GRSEARCH_GetInfeasExt) */
+    T->Sum[m * T->Stride + SetNr] =
+      (FullSetOnly) ? RPtr->LP[SetNr].BAL[1] : RPtr->LP[SetNr].BAL[m];
+    T->Key[m * T->Stride + SetNr] = Key;
   }
 }
 
+/* GRSEARCH_GetInfeasExt on the anti-sets whose prefix of MinCandidateIdx
+   nodes has the node sum and the key of the actual set (NodeSum, SetKey)
+   plus a candidate. Any anti-set labelling a node is among them. */
+static void LGRSEARCH_GetInfeasExtTable(int *Pos,
+                                        int MinCandidateIdx,
+                                        int MaxCandidateIdx,
+                                        int NoOfCustomers,
+                                        int NodeSum,
+                                        unsigned int SetKey,
+                                        ReachPtr RPtr,
+                                        int RPtrSize,
+                                        PrefixTableRec *T,
+                                        int *NodeLabel,
+                                        int Label)
+{
+  int SetNr,DiffNode;
+  int *Sum;
+  unsigned int *Key;
+  char CallBack;
+
+  Sum = T->Sum + MinCandidateIdx * T->Stride;
+  Key = T->Key + MinCandidateIdx * T->Stride;
+
+  for (SetNr=1; SetNr<=RPtrSize; SetNr++)
+  {
+    DiffNode = Sum[SetNr] - NodeSum;
+    if ((DiffNode < 1) || (DiffNode > NoOfCustomers)) continue;
+    if (Key[SetNr] != (SetKey ^ T->NodeKey[DiffNode])) continue;
+
+    LGRSEARCH_CheckInfeasExt(Pos,MinCandidateIdx,MaxCandidateIdx,
+                             NoOfCustomers,NodeSum,RPtr,SetNr,
+                             NodeLabel,Label,&CallBack);
+  }
+}
+
+#endif
+
 void GRSEARCH_GetNotOKSources(ReachPtr RPtr,
                               int RPtrSize,
                               char *OKSource)
@@ -167,12 +292,12 @@ void GRSEARCH_GetNotOKSources(ReachPtr RPtr,
   }
 }
 
-void GRSEARCH_CapCuts(ReachPtr SupportPtr,
+void GRSEARCH_CapCuts(CSRGraphPtr SupportPtr,
                       int NoOfCustomers,
                       int *Demand, int CAP,
                       int *SuperNodeSize,
                       double *XInSuperNode,
-                      double **XMatrix,
+                      SparseMatrixPtr XMatrix,
                       int *GeneratedSets,
                       int *GeneratedAntiSets,
                       ReachPtr SetsRPtr, /* Identified cuts. */
@@ -181,6 +306,11 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
 {
   const double EpsViolation = 0.01;
   char CallBackAntiSets;
+#if GRSEARCH_PREFIX_TABLE
+  char UseTable;
+  unsigned int SetKey;
+  PrefixTableRec T;
+#endif
   int i,j,k;
   int Source,BestNode,NodeSum;
   int MinCandidateIdx,MaxCandidateIdx;
@@ -216,6 +346,28 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
   GRSEARCH_GetNotOKSources(AntiSetsRPtr,*GeneratedAntiSets,
                            OKSource);
 
+#if GRSEARCH_PREFIX_TABLE
+  /* Anti-sets 1..AntiSetsRPtr->n, prefixes of 2..NoOfCustomers nodes. */
+  T.Rows = NoOfCustomers + 1;
+  T.Stride = AntiSetsRPtr->n + 1;
+  UseTable = ((1.0 * T.Rows * T.Stride) <= GRSEARCH_MAX_TABLE_DIM);
+
+  SetKey = 0;
+  if (UseTable)
+  {
+    T.Sum = MemGetIV(T.Rows * T.Stride);
+    T.Key = (unsigned int *) MemGet(sizeof(int) * T.Rows * T.Stride);
+    T.NodeKey = (unsigned int *) MemGet(sizeof(int) * (NoOfCustomers+1));
+
+    for (i=1; i<=NoOfCustomers; i++) T.NodeKey[i] = LGRSEARCH_NodeKey(i);
+
+    for (i=1; i<=*GeneratedAntiSets; i++)
+    {
+      LGRSEARCH_TableAddSet(&T,AntiSetsRPtr,i);
+    }
+  }
+#endif
+
   for (Source=NoOfCustomers; Source>=1; Source--)
   {
     if (OKSource[Source] == 0) continue;
@@ -263,14 +415,14 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
     MaxCandidateIdx = 1; /* Max < Min <=> no candidates. */
 
     /* Put the nodes adjacent to Source in candidate positions. */
-    for (j=1; j<=SupportPtr->LP[Source].CFN; j++)
+    for (j=SupportPtr->FirstArc[Source]; j<SupportPtr->FirstArc[Source+1]; j++)
     {
-      k = SupportPtr->LP[Source].FAL[j];
+      k = SupportPtr->ArcHead[j];
       if (k <= NoOfCustomers)
       {
         MaxCandidateIdx++;
         GRSEARCH_SwapNodesInPos(Node,Pos,MaxCandidateIdx,Pos[k]);
-        XVal[k] = XMatrix[Source][k];
+        XVal[k] = SPM_Get(XMatrix,Source,k);
       }
     }
 
@@ -278,6 +430,10 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
 
     CallBackAntiSets = 1;
 
+#if GRSEARCH_PREFIX_TABLE
+    if (UseTable) SetKey = T.NodeKey[Source];
+#endif
+
     BestNode = 1;
 
     while ((MinCandidateIdx <= MaxCandidateIdx) &&
@@ -289,6 +445,22 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
       /* Label the nodes that are not feasible for inclusion. */
       Label++;
 
+#if GRSEARCH_PREFIX_TABLE
+      if (UseTable)
+      {
+        LGRSEARCH_GetInfeasExtTable(Pos,
+                                    MinCandidateIdx,MaxCandidateIdx,
+                                    NoOfCustomers,
+                                    NodeSum,
+                                    SetKey,
+                                    AntiSetsRPtr,
+                                    (*GeneratedAntiSets),
+                                    &T,
+                                    NodeLabel,
+                                    Label);
+      }
+      else
+#endif
       if (CallBackAntiSets)
       {
         GRSEARCH_GetInfeasExt(Pos,
@@ -367,6 +539,9 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
         MinCandidateIdx++;
 
         NodeSum += BestNode;
+#if GRSEARCH_PREFIX_TABLE
+        if (UseTable) SetKey ^= T.NodeKey[BestNode];
+#endif
 
         OrigNodesInSet += SuperNodeSize[BestNode];
         DemandSum += Demand[BestNode];
@@ -406,22 +581,23 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
         }
 
         /* Update X-values and candidate set. */
-        for (j=1; j<=SupportPtr->LP[BestNode].CFN; j++)
+        for (j=SupportPtr->FirstArc[BestNode];
+             j<SupportPtr->FirstArc[BestNode+1]; j++)
         {
-          k = SupportPtr->LP[BestNode].FAL[j];
+          k = SupportPtr->ArcHead[j];
           if (k > NoOfCustomers) continue; /* Depot. */
 
           if (Pos[k] > MaxCandidateIdx)
           {
             /* k is a new candidate. */
-            XVal[k] = XMatrix[BestNode][k];
+            XVal[k] = SPM_Get(XMatrix,BestNode,k);
             MaxCandidateIdx++;
             GRSEARCH_SwapNodesInPos(Node,Pos,MaxCandidateIdx,Pos[k]);
           }
           else
           if (Pos[k] >= MinCandidateIdx)
           {
-            XVal[k] += XMatrix[BestNode][k];
+            XVal[k] += SPM_Get(XMatrix,BestNode,k);
           }
         }
       }
@@ -433,6 +609,10 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
                     *GeneratedAntiSets,
                     MinCandidateIdx-1,
                     Node,1);
+
+#if GRSEARCH_PREFIX_TABLE
+    if (UseTable) LGRSEARCH_TableAddSet(&T,AntiSetsRPtr,*GeneratedAntiSets);
+#endif
   }
 
   MemFree(OKSource);
@@ -440,6 +620,14 @@ void GRSEARCH_CapCuts(ReachPtr SupportPtr,
   MemFree(Pos);
   MemFree(NodeLabel);
   MemFree(XVal);
+#if GRSEARCH_PREFIX_TABLE
+  if (UseTable)
+  {
+    MemFree(T.Sum);
+    MemFree(T.Key);
+    MemFree(T.NodeKey);
+  }
+#endif
 }
 
 void GRSEARCH_CheckForExistingSet(ReachPtr RPtr,
@@ -480,14 +668,14 @@ void GRSEARCH_CheckForExistingSet(ReachPtr RPtr,
   }
 }
 
-void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
+void GRSEARCH_AddDropCapsOnGS(CSRGraphPtr SupportPtr, /* On GS */
                               int NoOfCustomers,
                               int ShrunkGraphCustNodes,
                               int *SuperDemand, int CAP,
                               int *SuperNodeSize,
                               double *XInSuperNode,
                               ReachPtr SuperNodesRPtr,
-                              double **SMatrix, /* Shrunk graph */
+                              SparseMatrixPtr SMatrix, /* Shrunk graph */
                               double Eps,
                               CnstrMgrPointer CMPSourceCutList,
                               int *NoOfGeneratedSets,
@@ -585,12 +773,12 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
 
     for (i=1; i<=ShrunkGraphCustNodes; i++)
     {
-      for (k=1; k<=SupportPtr->LP[i].CFN; k++)
+      for (k=SupportPtr->FirstArc[i]; k<SupportPtr->FirstArc[i+1]; k++)
       {
-        j = SupportPtr->LP[i].FAL[k];
+        j = SupportPtr->ArcHead[k];
         if ((j <= ShrunkGraphCustNodes) && (j > i))
         {
-          XVal = SMatrix[i][j];
+          XVal = SPM_Get(SMatrix,i,j);
           if (NodeLabel[i] == Label) XNodeSum[j] += XVal;
           if (NodeLabel[j] == Label) XNodeSum[i] += XVal;
           if ((NodeLabel[i] == Label) &&
@@ -628,12 +816,13 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
         (NodeLabel[CustNr])--;
         NodeSum -= CustNr;
 
-        for (k=1; k<=SupportPtr->LP[CustNr].CFN; k++)
+        for (k=SupportPtr->FirstArc[CustNr];
+             k<SupportPtr->FirstArc[CustNr+1]; k++)
         {
-          j = SupportPtr->LP[CustNr].FAL[k];
+          j = SupportPtr->ArcHead[k];
           if (j <= ShrunkGraphCustNodes)
           {
-            XVal = SMatrix[j][CustNr];
+            XVal = SPM_Get(SMatrix,j,CustNr);
             XNodeSum[j] -= XVal;
           }
         }
@@ -651,12 +840,13 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
       (NodeLabel[LastRemoved])++;
       NodeSum += LastRemoved;
 
-      for (k=1; k<=SupportPtr->LP[LastRemoved].CFN; k++)
+      for (k=SupportPtr->FirstArc[LastRemoved];
+           k<SupportPtr->FirstArc[LastRemoved+1]; k++)
       {
-        j = SupportPtr->LP[LastRemoved].FAL[k];
+        j = SupportPtr->ArcHead[k];
         if (j <= ShrunkGraphCustNodes)
         {
-          XVal = SMatrix[j][LastRemoved];
+          XVal = SPM_Get(SMatrix,j,LastRemoved);
           XNodeSum[j] += XVal;
         }
       }
@@ -694,12 +884,13 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
         (NodeLabel[CustNr])--;
         NodeSum -= CustNr;
 
-        for (k=1; k<=SupportPtr->LP[CustNr].CFN; k++)
+        for (k=SupportPtr->FirstArc[CustNr];
+             k<SupportPtr->FirstArc[CustNr+1]; k++)
         {
-          j = SupportPtr->LP[CustNr].FAL[k];
+          j = SupportPtr->ArcHead[k];
           if (j <= ShrunkGraphCustNodes)
           {
-            XVal = SMatrix[j][CustNr];
+            XVal = SPM_Get(SMatrix,j,CustNr);
             XNodeSum[j] -= XVal;
           }
         }
@@ -761,12 +952,13 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
         (NodeLabel[CustNr])--;
         NodeSum -= CustNr;
 
-        for (k=1; k<=SupportPtr->LP[CustNr].CFN; k++)
+        for (k=SupportPtr->FirstArc[CustNr];
+             k<SupportPtr->FirstArc[CustNr+1]; k++)
         {
-          j = SupportPtr->LP[CustNr].FAL[k];
+          j = SupportPtr->ArcHead[k];
           if (j <= ShrunkGraphCustNodes)
           {
-            XVal = SMatrix[j][CustNr];
+            XVal = SPM_Get(SMatrix,j,CustNr);
             XNodeSum[j] -= XVal;
           }
         }
@@ -794,12 +986,13 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
         NodeLabel[BestNewNode] = Label;
         NodeSum += BestNewNode;
 
-        for (k=1; k<=SupportPtr->LP[BestNewNode].CFN; k++)
+        for (k=SupportPtr->FirstArc[BestNewNode];
+             k<SupportPtr->FirstArc[BestNewNode+1]; k++)
         {
-          j = SupportPtr->LP[BestNewNode].FAL[k];
+          j = SupportPtr->ArcHead[k];
           if (j <= ShrunkGraphCustNodes)
           {
-            XVal = SMatrix[j][BestNewNode];
+            XVal = SPM_Get(SMatrix,j,BestNewNode);
             XNodeSum[j] += XVal;
           }
         }
@@ -819,9 +1012,9 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
               if ((SuperDemand[i] - SuperDemand[BestNewNode]) <=
                    RemainingCAPSlack)
               {
-                if ((XNodeSum[i] + SMatrix[BestNewNode][i]) < MinX)
+                if ((XNodeSum[i] + SPM_Get(SMatrix,BestNewNode,i)) < MinX)
                 {
-                  MinX = XNodeSum[i] + SMatrix[BestNewNode][i];
+                  MinX = XNodeSum[i] + SPM_Get(SMatrix,BestNewNode,i);
                   MinXNode = i;
                 }
               }
@@ -850,12 +1043,13 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
             NodeLabel[BestNewNode] = Label;
             NodeSum += BestNewNode;
 
-            for (k=1; k<=SupportPtr->LP[BestNewNode].CFN; k++)
+            for (k=SupportPtr->FirstArc[BestNewNode];
+                 k<SupportPtr->FirstArc[BestNewNode+1]; k++)
             {
-              j = SupportPtr->LP[BestNewNode].FAL[k];
+              j = SupportPtr->ArcHead[k];
               if (j <= ShrunkGraphCustNodes)
               {
-                XVal = SMatrix[j][BestNewNode];
+                XVal = SPM_Get(SMatrix,j,BestNewNode);
                 XNodeSum[j] += XVal;
               }
             }
@@ -871,12 +1065,13 @@ void GRSEARCH_AddDropCapsOnGS(ReachPtr SupportPtr, /* On GS */
             (NodeLabel[CustNr])--;
             NodeSum -= CustNr;
 
-            for (k=1; k<=SupportPtr->LP[CustNr].CFN; k++)
+            for (k=SupportPtr->FirstArc[CustNr];
+                 k<SupportPtr->FirstArc[CustNr+1]; k++)
             {
-              j = SupportPtr->LP[CustNr].FAL[k];
+              j = SupportPtr->ArcHead[k];
               if (j <= ShrunkGraphCustNodes)
               {
-                XVal = SMatrix[j][CustNr];
+                XVal = SPM_Get(SMatrix,j,CustNr);
                 XNodeSum[j] -= XVal;
               }
             }
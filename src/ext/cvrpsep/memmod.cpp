@@ -4,13 +4,150 @@
 
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
+#include <vector>
 
 #include "../../../include/ext/cvrpsep/memmod.h"
 
+/* Arena blocks: a header holding the size requested (for MemReGet) followed
+   by the block, both multiples of ArenaAlign bytes. */
+static const size_t ArenaAlign = 16;
+static const size_t ArenaHeader = 16;
+static const size_t ArenaMinChunk = 1 << 16;
+
+typedef struct
+{
+  char *Base;
+  size_t Dim;
+  size_t Used;
+} ArenaChunk;
+
+class Arena
+{
+public:
+
+  ~Arena()
+  {
+    for (auto &c : Chunks) free(c.Base);
+  }
+
+  /* 0: MemGet* use malloc */
+  int Active = 0;
+  std::vector<ArenaChunk> Chunks;
+  /* bytes drawn since MemArenaBegin() */
+  size_t InUse = 0;
+};
+
+static thread_local Arena TLArena;
+static std::atomic<long> ArenaPeak(0);
+
+static void* ArenaGet(size_t NoOfBytes)
+{
+  size_t Size = ArenaHeader +
+                (NoOfBytes + ArenaAlign - 1) / ArenaAlign * ArenaAlign;
+
+  if (TLArena.Chunks.empty() ||
+      TLArena.Chunks.back().Used + Size > TLArena.Chunks.back().Dim)
+  {
+    size_t Dim = TLArena.Chunks.empty() ? ArenaMinChunk :
+                 2 * TLArena.Chunks.back().Dim;
+    Dim = std::max(Dim,Size);
+
+    ArenaChunk c;
+    if ((c.Base = (char *) malloc(Dim)) == NULL)
+    {
+      printf("*** MemGet(%d bytes)\n",(int) NoOfBytes);
+      printf("*** Error in memory allocation\n");
+      exit(0);     /* Program stop. */
+    }
+    c.Dim = Dim;
+    c.Used = 0;
+    TLArena.Chunks.push_back(c);
+  }
+
+  ArenaChunk &c = TLArena.Chunks.back();
+  char *p = c.Base + c.Used;
+  c.Used += Size;
+  TLArena.InUse += Size;
+
+  *((size_t *) p) = NoOfBytes;
+  return p + ArenaHeader;
+}
+
+static int ArenaOwns(void *p)
+{
+  for (auto &c : TLArena.Chunks)
+  {
+    if ((char *) p >= c.Base && (char *) p < c.Base + c.Dim) return 1;
+  }
+  return 0;
+}
+
+void MemArenaBegin(void)
+{
+  TLArena.Active = 1;
+}
+
+void MemArenaEnd(void)
+{
+  long Used = (long) TLArena.InUse;
+  long Peak = ArenaPeak.load();
+  while (Used > Peak && !ArenaPeak.compare_exchange_weak(Peak,Used));
+
+  /* the next separation fits in a single chunk */
+  if (TLArena.Chunks.size() > 1)
+  {
+    size_t Dim = 0;
+    for (auto &c : TLArena.Chunks)
+    {
+      Dim += c.Dim;
+      free(c.Base);
+    }
+    TLArena.Chunks.clear();
+
+    ArenaChunk c;
+    c.Base = (char *) malloc(Dim);
+    c.Dim = c.Base != NULL ? Dim : 0;
+    c.Used = 0;
+    if (c.Base != NULL) TLArena.Chunks.push_back(c);
+  }
+  else if (!TLArena.Chunks.empty())
+  {
+    TLArena.Chunks.back().Used = 0;
+  }
+
+  TLArena.InUse = 0;
+  TLArena.Active = 0;
+}
+
+int MemArenaSuspend(void)
+{
+  int Active = TLArena.Active;
+  TLArena.Active = 0;
+  return Active;
+}
+
+void MemArenaResume(int Active)
+{
+  TLArena.Active = Active;
+}
+
+long MemArenaPeak(void)
+{
+  return ArenaPeak.load();
+}
+
 void* MemGet(int NoOfBytes)
 {
   void *p;
-  if ((p = malloc(NoOfBytes)) != NULL)
+  if (TLArena.Active)
+  {
+    return ArenaGet(NoOfBytes);
+  }
+  else if ((p = malloc(NoOfBytes)) != NULL)
   {
     return p;
   }
@@ -27,6 +164,14 @@ void* MemReGet(void *p, int NewNoOfBytes)
 {
   if (p==NULL) return MemGet(NewNoOfBytes);
 
+  if (ArenaOwns(p))
+  {
+    size_t OldNoOfBytes = *((size_t *) ((char *) p - ArenaHeader));
+    void *q = ArenaGet(NewNoOfBytes);
+    memcpy(q,p,std::min(OldNoOfBytes,(size_t) NewNoOfBytes));
+    return q;
+  }
+
   if ((p = realloc(p,NewNoOfBytes)) != NULL)
   {
     return p;
@@ -42,7 +187,7 @@ void* MemReGet(void *p, int NewNoOfBytes)
 
 void MemFree(void *p)
 {
-  if (p!=NULL)
+  if (p!=NULL && !ArenaOwns(p))
   {
     free(p);
   }
@@ -53,23 +198,24 @@ char* MemGetCV(int n)
   return (char *) MemGet(sizeof(char)*n);
 }
 
+/* Matrices: the row pointers and one contiguous block for the entries. */
+
 char** MemGetCM(int Rows, int Cols)
 {
   char **p;
+  char *Block;
   int i;
   p = (char **) MemGet(sizeof(char *)*Rows);
-  if (p!=NULL)
+  Block = (char *) MemGet(sizeof(char)*Rows*Cols);
   for (i=0; i<Rows; i++)
-  p[i] = (char *) MemGet(sizeof(char)*Cols);
+  p[i] = Block + (size_t) i*Cols;
 
   return p;
 }
 
 void MemFreeCM(char **p, int Rows)
 {
-  int i;
-  for (i=0; i<Rows; i++)
-  MemFree(p[i]);
+  if (Rows > 0) MemFree(p[0]);
   MemFree(p);
 }
 
@@ -81,21 +227,20 @@ int* MemGetIV(int n)
 int** MemGetIM(int Rows, int Cols)
 {
   int **p;
+  int *Block;
   int i;
 
   p = (int **) MemGet(sizeof(int *)*Rows);
-  if (p!=NULL)
+  Block = (int *) MemGet(sizeof(int)*Rows*Cols);
   for (i=0; i<Rows; i++)
-  p[i] = (int *) MemGet(sizeof(int)*Cols);
+  p[i] = Block + (size_t) i*Cols;
 
   return p;
 }
 
 void MemFreeIM(int **p, int Rows)
 {
-  int i;
-  for (i=0; i<Rows; i++)
-  MemFree(p[i]);
+  if (Rows > 0) MemFree(p[0]);
   MemFree(p);
 }
 
@@ -107,21 +252,20 @@ double* MemGetDV(int n)
 double** MemGetDM(int Rows, int Cols)
 {
   double **p;
+  double *Block;
   int i;
 
   p = (double **) MemGet(sizeof(double *)*Rows);
-  if (p!=NULL)
+  Block = (double *) MemGet(sizeof(double)*Rows*Cols);
   for (i=0; i<Rows; i++)
-  p[i] = (double *) MemGet(sizeof(double)*Cols);
+  p[i] = Block + (size_t) i*Cols;
 
   return p;
 }
 
 void MemFreeDM(double **p, int Rows)
 {
-  int i;
-  for (i=0; i<Rows; i++)
-  MemFree(p[i]);
+  if (Rows > 0) MemFree(p[0]);
   MemFree(p);
 }
 
@@ -2,6 +2,19 @@
 /* OSI Certified Open Source Software */
 /* This software is licensed under the Common Public License Version 1.0 */
 
+/* Highest-label push-relabel with the gap and global relabeling heuristics.
+
+   MXF_CreateMates stores the residual network in forward star form: the
+   out-arcs of node i are FirstOut[i],...,FirstOut[i+1]-1, sorted by head, and
+   each arc field is an array of its own. MXF_ChgArcCap finds an arc by a
+   binary search, and a discharge scans contiguous memory.
+
+   The flow is kept between the calls: MXF_SolveMaxFlow with InitByZeroFlow=0
+   starts from the current flow (or from the one given to MXF_SetFlow). A
+   capacity decreased below the flow on its arc leaves an excess at the tail
+   and a deficit at the head of the arc; the deficits are removed (by
+   cancelling flow) when the next solve starts. */
+
 #include <stdlib.h>
 #include <stdio.h>
 
@@ -10,52 +23,53 @@
 
 typedef struct
 {
-  int R; /* Residual capacity of the arc */
-  int U; /* Capacity of the arc */
-  int Tail;
-  int Head;
-  int Mate;
-  int NextInArc;
-  int NextOutArc;
-} MXF_ArcRec;
-typedef MXF_ArcRec *MXF_ArcPtr;
-
-typedef struct
-{
-  int DLabel;
-  int Excess;
-  int FirstInArc;
-  int LastInArc;
-  int FirstOutArc;
-  int LastOutArc;
-  int CurrentArc;
-  int PrevBNode;    /* Previous Bucket Node */
-  int NextBNode;    /* Next -               */
-  int PrevDLNode;   /* Previous Distance Label Node */
-  int NextDLNode;   /* Next -                       */
-} MXF_NodeRec;
-typedef MXF_NodeRec *MXF_NodePtr;
-
-typedef struct
-{
-  MXF_ArcPtr ArcPtr;
-  MXF_NodePtr NodePtr;
+  /* Arcs given to MXF_AddArc: 1..ArcListSize */
   int ArcListDim;
   int ArcListSize;
+  int *InTail;
+  int *InHead;
+  int *InCap;
+
   int NodeListDim;
   int NodeListSize;
-  int *FirstInBPtr;   /* First Node in Bucket[i] */
-  int *FirstInDLPtr;  /* First Node in DistanceLabel[i] */
-  int **ArcMapPtr;
-  char *CVWrk1;
+
+  /* Residual network (MXF_CreateMates): arcs 1..NoOfArcs */
+  char Built;
+  int ResArcDim;
+  int NoOfArcs;
+  int *FirstOut;    /* 1..NodeListSize+1 */
+  int *Tail;
+  int *Head;
+  int *Mate;
+  int *U;           /* Capacity of the arc */
+  int *R;           /* Residual capacity of the arc (flow is U-R) */
+
+  int *Excess;
+  int *DLabel;
+  int *CurrentArc;
+  int *FirstInB;    /* First active node with distance label i */
+  int *NextBNode;
+  int *FirstInDL;   /* First node with distance label i (i < n) */
+  int *PrevDLNode;
+  int *NextDLNode;
+  int MaxBLevel;    /* Highest label with active nodes (upper bound) */
+  int MaxDLevel;    /* Highest label < n in use (upper bound) */
+  long WorkSinceUpdate;
+
+  int *Queue;
   int *IVWrk1;
   int *IVWrk2;
   int *IVWrk3;
-  int *IVWrk4;
-  int *IVWrk5;
 } MXF_Rec;
 typedef MXF_Rec *MXF_Ptr;
 
+/* A global relabeling is done when the work of the relabels since the last
+   one exceeds GR_Freq * (GR_Alpha * n + m); a relabel costs its scanned arcs
+   plus GR_Beta. */
+static const double GR_Freq = 0.5;
+static const int GR_Alpha = 6;
+static const int GR_Beta = 12;
+
 void MXF_WriteArcList(MaxFlowPtr Ptr)
 {
   int i;
@@ -63,23 +77,26 @@ void MXF_WriteArcList(MaxFlowPtr Ptr)
 
   P = (MXF_Ptr) Ptr;
 
-  printf("ArcList: (ArcListSize=%d, ArcListDim=%d)\n",
-          P->ArcListSize,P->ArcListDim);
-  printf("[NodeList: (NodeListSize=%d,NodeListDim=%d]\n",
-          P->NodeListSize,P->NodeListDim);
-  printf(" Arc#    R    U Tail Head Mate NextOutArc NextInArc\n");
-  printf("---------------------------------------------------\n");
-  for (i=1; i<=P->ArcListSize; i++)
-  printf("%5d%5d%5d%5d%5d%5d%7d%10d\n",
-         i,
-         P->ArcPtr[i].R,
-         P->ArcPtr[i].U,
-         P->ArcPtr[i].Tail,
-         P->ArcPtr[i].Head,
-         P->ArcPtr[i].Mate,
-         P->ArcPtr[i].NextOutArc,
-         P->ArcPtr[i].NextInArc);
-  printf("----------------------------------------------\n");
+  if (P->Built == 0)
+  {
+    printf("ArcList: (ArcListSize=%d, ArcListDim=%d)\n",
+            P->ArcListSize,P->ArcListDim);
+    printf(" Arc# Tail Head    U\n");
+    printf("---------------------\n");
+    for (i=1; i<=P->ArcListSize; i++)
+    printf("%5d%5d%5d%5d\n",i,P->InTail[i],P->InHead[i],P->InCap[i]);
+    printf("---------------------\n");
+    return;
+  }
+
+  printf("ArcList: (NoOfArcs=%d, ResArcDim=%d)\n",
+          P->NoOfArcs,P->ResArcDim);
+  printf(" Arc#    R    U Tail Head Mate\n");
+  printf("------------------------------\n");
+  for (i=1; i<=P->NoOfArcs; i++)
+  printf("%5d%5d%5d%5d%5d%5d\n",
+         i,P->R[i],P->U[i],P->Tail[i],P->Head[i],P->Mate[i]);
+  printf("------------------------------\n");
 }
 
 void MXF_WriteNodeList(MaxFlowPtr Ptr)
@@ -91,70 +108,84 @@ void MXF_WriteNodeList(MaxFlowPtr Ptr)
 
   printf("NodeList: (NodeListSize=%d,NodeListDim=%d)\n",
           P->NodeListSize,P->NodeListDim);
-  printf(" Node  DL   Exc FOArc LOArc FIArc LIArc PrevB NextB PrevDL NextDL\n");
-  printf("-----------------------------------------------------------------\n");
+  printf(" Node  DL   Exc FOArc LOArc\n");
+  printf("---------------------------\n");
   for (i=1; i<=P->NodeListSize; i++)
   {
-    printf("%5d%5d%5d%5d%4d%6d%6d%6d%6d%6d%10d\n",
-           i,
-           P->NodePtr[i].DLabel,
-           P->NodePtr[i].Excess,
-           P->NodePtr[i].FirstOutArc,
-           P->NodePtr[i].LastOutArc,
-           P->NodePtr[i].FirstInArc,
-           P->NodePtr[i].LastInArc,
-           P->NodePtr[i].PrevBNode,
-           P->NodePtr[i].NextBNode,
-           P->NodePtr[i].PrevDLNode,
-           P->NodePtr[i].NextDLNode);
+    printf("%5d%5d%5d",i,P->DLabel[i],P->Excess[i]);
+    if (P->Built)
+    printf("%6d%6d",P->FirstOut[i],P->FirstOut[i+1]-1);
+    printf("\n");
   }
-  printf("---------------------------------------------------------------------\n");
+  printf("---------------------------\n");
+}
+
+static void LMXF_AllocResArcs(MXF_Ptr P,
+                              int Dim)
+{
+  P->ResArcDim = Dim;
+  P->Tail = MemGetIV(Dim+1);
+  P->Head = MemGetIV(Dim+1);
+  P->Mate = MemGetIV(Dim+1);
+  P->U = MemGetIV(Dim+1);
+  P->R = MemGetIV(Dim+1);
+}
+
+static void LMXF_FreeResArcs(MXF_Ptr P)
+{
+  MemFree(P->Tail);
+  MemFree(P->Head);
+  MemFree(P->Mate);
+  MemFree(P->U);
+  MemFree(P->R);
 }
 
 void MXF_InitMem(MaxFlowPtr *Ptr,
                  int TotalNodes,
                  int TotalArcs)
 {
-  MXF_Ptr P;
   int i;
+  MXF_Ptr P;
 
   (*Ptr) = (MaxFlowPtr) MemGet(sizeof(MXF_Rec));
 
   P = (MXF_Ptr) (*Ptr);
 
-  P->ArcPtr  = NULL;
-  P->NodePtr = NULL;
-
-  P->ArcMapPtr = NULL;
-
-  P->ArcListDim   = 0;
-  P->ArcListSize  = 0;
-  P->NodeListDim  = 0;
-  P->NodeListSize = 0;
+  if (TotalArcs < 1) TotalArcs = 1;
 
-  P->ArcPtr = (MXF_ArcPtr) MemGet(sizeof(MXF_ArcRec) * (TotalArcs+1));
   P->ArcListDim = TotalArcs; /* Space for 1,...,TotalArcs (excl. #0) */
-  P->ArcListSize = 0; /* Currently no arcs in the network */
+  P->ArcListSize = 0;
+  P->InTail = MemGetIV(TotalArcs+1);
+  P->InHead = MemGetIV(TotalArcs+1);
+  P->InCap = MemGetIV(TotalArcs+1);
 
-  P->NodePtr = (MXF_NodePtr) MemGet(sizeof(MXF_NodeRec) * (TotalNodes+1));
   P->NodeListDim = TotalNodes;
-  P->NodeListSize = 0; /* Currently no nodes in the network */
+  P->NodeListSize = 0;
 
-  P->FirstInBPtr  = MemGetIV(TotalNodes+1);
-  P->FirstInDLPtr = MemGetIV(TotalNodes+1);
+  P->Built = 0;
+  P->NoOfArcs = 0;
+  LMXF_AllocResArcs(P,2*TotalArcs);
+
+  P->FirstOut = MemGetIV(TotalNodes+2);
+  P->Excess = MemGetIV(TotalNodes+1);
+  P->DLabel = MemGetIV(TotalNodes+1);
+  P->CurrentArc = MemGetIV(TotalNodes+1);
+  P->FirstInB = MemGetIV(TotalNodes+1);
+  P->NextBNode = MemGetIV(TotalNodes+1);
+  P->FirstInDL = MemGetIV(TotalNodes+1);
+  P->PrevDLNode = MemGetIV(TotalNodes+1);
+  P->NextDLNode = MemGetIV(TotalNodes+1);
+
+  P->Queue = MemGetIV(TotalNodes+1);
+  P->IVWrk1 = MemGetIV(TotalNodes+2);
+  P->IVWrk2 = MemGetIV(TotalNodes+2);
+  P->IVWrk3 = MemGetIV(TotalNodes+2);
 
   for (i=0; i<=TotalNodes; i++)
   {
-    P->FirstInBPtr[i]  = 0;
-    P->FirstInDLPtr[i] = 0;
+    P->Excess[i] = 0;
+    P->DLabel[i] = 0;
   }
-
-  P->CVWrk1 = MemGetCV(TotalNodes+1);
-  P->IVWrk1 = MemGetIV(TotalNodes+1);
-  P->IVWrk2 = MemGetIV(TotalNodes+1);
-  P->IVWrk3 = MemGetIV(TotalNodes+1);
-  P->IVWrk4 = MemGetIV(TotalNodes+1);
-  P->IVWrk5 = MemGetIV(TotalNodes+1);
 }
 
 void MXF_FreeMem(MaxFlowPtr Ptr)
@@ -163,21 +194,26 @@ void MXF_FreeMem(MaxFlowPtr Ptr)
 
   P = (MXF_Ptr) Ptr;
 
-  MemFree(P->CVWrk1);
-  MemFree(P->IVWrk1);
-  MemFree(P->IVWrk2);
-  MemFree(P->IVWrk3);
-  MemFree(P->IVWrk4);
-  MemFree(P->IVWrk5);
+  MemFree(P->InTail);
+  MemFree(P->InHead);
+  MemFree(P->InCap);
 
-  MemFree(P->FirstInBPtr);
-  MemFree(P->FirstInDLPtr);
+  LMXF_FreeResArcs(P);
 
-  MemFree(P->NodePtr);
-  MemFree(P->ArcPtr);
+  MemFree(P->FirstOut);
+  MemFree(P->Excess);
+  MemFree(P->DLabel);
+  MemFree(P->CurrentArc);
+  MemFree(P->FirstInB);
+  MemFree(P->NextBNode);
+  MemFree(P->FirstInDL);
+  MemFree(P->PrevDLNode);
+  MemFree(P->NextDLNode);
 
-  if (P->ArcMapPtr != NULL)
-  MemFreeIM(P->ArcMapPtr,P->NodeListSize+1);
+  MemFree(P->Queue);
+  MemFree(P->IVWrk1);
+  MemFree(P->IVWrk2);
+  MemFree(P->IVWrk3);
 
   MemFree(P);
 }
@@ -192,36 +228,23 @@ void MXF_ClearNodeList(MaxFlowPtr Ptr)
 
   for (i=0; i<=P->NodeListDim; i++)
   {
-    P->NodePtr[i].DLabel      = 0;
-    P->NodePtr[i].Excess      = 0;
-    P->NodePtr[i].FirstInArc  = 0;
-    P->NodePtr[i].LastInArc   = 0;
-    P->NodePtr[i].FirstOutArc = 0;
-    P->NodePtr[i].LastOutArc  = 0;
+    P->Excess[i] = 0;
+    P->DLabel[i] = 0;
   }
 
   P->NodeListSize = 0;
+  P->Built = 0;
 }
 
 void MXF_ClearArcList(MaxFlowPtr Ptr)
 {
-  int i;
   MXF_Ptr P;
 
   P = (MXF_Ptr) Ptr;
 
-  for (i=0; i<=P->ArcListDim; i++)
-  {
-    P->ArcPtr[i].R          = 0;
-    P->ArcPtr[i].U          = 0;
-    P->ArcPtr[i].Tail       = 0;
-    P->ArcPtr[i].Head       = 0;
-    P->ArcPtr[i].Mate       = 0;
-    P->ArcPtr[i].NextInArc  = 0;
-    P->ArcPtr[i].NextOutArc = 0;
-  }
-
   P->ArcListSize = 0;
+  P->NoOfArcs = 0;
+  P->Built = 0;
 }
 
 void MXF_SetNodeListSize(MaxFlowPtr Ptr,
@@ -243,20 +266,19 @@ void MXF_SetNodeListSize(MaxFlowPtr Ptr,
   P->NodeListSize = TotalNodes;
 }
 
-void LMXF_AddArc(MaxFlowPtr Ptr,
-                 int Tail,
-                 int Head,
-                 int Capacity,
-                 int *Index)
+void MXF_AddArc(MaxFlowPtr Ptr,
+                int Tail,
+                int Head,
+                int Capacity)
 {
-  int i,j,TotMem;
+  int i;
   MXF_Ptr P;
 
   P = (MXF_Ptr) Ptr;
 
   if ((Tail<=0) || (Tail>P->NodeListSize) ||
       (Head<=0) || (Head>P->NodeListSize) ||
-      (Capacity < 0))
+      (Capacity < 0) || (P->Built))
   {
     printf("Error in input to MXF_AddArc(NodeListSize=%d)\n",
            P->NodeListSize);
@@ -267,59 +289,36 @@ void LMXF_AddArc(MaxFlowPtr Ptr,
   if (i > P->ArcListDim)
   {
     /* Allocate more memory. */
-    P->ArcListDim = i + 100;
-    TotMem = sizeof(MXF_ArcRec) * (P->ArcListDim + 1);
-    P->ArcPtr = (MXF_ArcPtr) MemReGet(P->ArcPtr,TotMem);
+    P->ArcListDim = 2 * P->ArcListDim + 100;
+    P->InTail = (int *) MemReGet(P->InTail,sizeof(int)*(P->ArcListDim+1));
+    P->InHead = (int *) MemReGet(P->InHead,sizeof(int)*(P->ArcListDim+1));
+    P->InCap = (int *) MemReGet(P->InCap,sizeof(int)*(P->ArcListDim+1));
   }
 
-  (P->ArcListSize)++;
-
-  P->ArcPtr[i].Tail       = Tail;
-  P->ArcPtr[i].Head       = Head;
-  P->ArcPtr[i].U          = Capacity;
-  P->ArcPtr[i].R          = Capacity;
-  P->ArcPtr[i].NextInArc  = 0;
-  P->ArcPtr[i].NextOutArc = 0;
-
-  /* Update references. */
-
-  if (P->NodePtr[Tail].FirstOutArc == 0)
-  {
-    P->NodePtr[Tail].FirstOutArc = i;
-    P->NodePtr[Tail].LastOutArc  = i;
-  }
-  else
-  {
-    j = P->NodePtr[Tail].LastOutArc;
-    P->ArcPtr[j].NextOutArc = i;
+  P->ArcListSize = i;
+  P->InTail[i] = Tail;
+  P->InHead[i] = Head;
+  P->InCap[i] = Capacity;
+}
 
-    P->NodePtr[Tail].LastOutArc = i;
-  }
+static int LMXF_FindArc(MXF_Ptr P,
+                        int Tail,
+                        int Head)
+{
+  /* Returns 0 if the network has no arc (Tail,Head). */
+  int Lo,Hi,Mid;
 
-  if (P->NodePtr[Head].FirstInArc == 0)
+  Lo = P->FirstOut[Tail];
+  Hi = P->FirstOut[Tail+1] - 1;
+  while (Lo <= Hi)
   {
-    P->NodePtr[Head].FirstInArc = i;
-    P->NodePtr[Head].LastInArc  = i;
-  }
-  else
-  {
-    j = P->NodePtr[Head].LastInArc;
-    P->ArcPtr[j].NextInArc = i;
-
-    P->NodePtr[Head].LastInArc = i;
+    Mid = (Lo + Hi) / 2;
+    if (P->Head[Mid] == Head) return Mid;
+    if (P->Head[Mid] < Head) Lo = Mid + 1;
+    else Hi = Mid - 1;
   }
 
-  *Index = i;
-
-}
-
-void MXF_AddArc(MaxFlowPtr Ptr,
-                int Tail,
-                int Head,
-                int Capacity)
-{
-  int i;
-  LMXF_AddArc(Ptr,Tail,Head,Capacity,&i);
+  return 0;
 }
 
 void MXF_ChgArcCap(MaxFlowPtr Ptr,
@@ -327,396 +326,502 @@ void MXF_ChgArcCap(MaxFlowPtr Ptr,
                    int Head,
                    int Capacity)
 {
-  int i,ArcNr,Delta;
+  int i,ArcNr,Over;
   MXF_Ptr P;
 
   P = (MXF_Ptr) Ptr;
 
-  if (P->ArcMapPtr == NULL)
+  if (P->Built == 0)
   {
-    ArcNr = 0;
     for (i=1; i<=P->ArcListSize; i++)
     {
-      if ((P->ArcPtr[i].Tail == Tail) && (P->ArcPtr[i].Head == Head))
+      if ((P->InTail[i] == Tail) && (P->InHead[i] == Head))
       {
-        ArcNr = i;
-        break;
+        P->InCap[i] = Capacity;
+        return;
       }
     }
+    ArcNr = 0;
   }
   else
   {
-    ArcNr = P->ArcMapPtr[Tail][Head];
+    ArcNr = LMXF_FindArc(P,Tail,Head);
   }
 
-  if (ArcNr > 0)
-  {
-    Delta = Capacity - P->ArcPtr[ArcNr].U;
-    P->ArcPtr[ArcNr].R += Delta;
-
-    P->ArcPtr[ArcNr].U = Capacity;
-  }
-  else
+  if (ArcNr == 0)
   {
     printf("MXF_ChgArcCap: Arc (%d,%d) not found => stop.\n",
             Tail,Head);
     exit(0);
   }
+
+  P->R[ArcNr] += Capacity - P->U[ArcNr];
+  P->U[ArcNr] = Capacity;
+
+  if (P->R[ArcNr] < 0)
+  {
+    /* The flow exceeds the new capacity: the surplus goes back to the tail,
+       and the head is left with a deficit. */
+    Over = -P->R[ArcNr];
+    P->R[ArcNr] = 0;
+    P->R[P->Mate[ArcNr]] -= Over;
+    P->Excess[Tail] += Over;
+    P->Excess[Head] -= Over;
+  }
 }
 
-void MXF_UpdateDLList(MaxFlowPtr Ptr)
+static void LMXF_PairArcs(MXF_Ptr P,
+                          int *PairOf)
 {
-  MXF_Ptr P;
-  int i,n,DL,FirstNode;
-
-  P = (MXF_Ptr) Ptr;
+  /* PairOf[a] = b if the input arcs a = (i,j) and b = (j,i) are mates,
+     PairOf[a] = 0 if a gets a new mate of zero capacity. */
+  int a,b,j,k,n,m,Pos;
+  int *GroupEnd, *Slot, *NextInSlot, *Order;
 
   n = P->NodeListSize;
+  m = P->ArcListSize;
 
-  for (i=1; i<=n; i++)
+  GroupEnd = P->IVWrk1;
+  Slot = P->IVWrk2;
+  NextInSlot = MemGetIV(m+1);
+  Order = MemGetIV(m+1);
+
+  /* Input arcs grouped by their smaller end node k. */
+  for (k=0; k<=n; k++) GroupEnd[k] = 0;
+  for (a=1; a<=m; a++)
   {
-    P->NodePtr[i].PrevDLNode = 0;
-    P->NodePtr[i].NextDLNode = 0;
+    k = (P->InTail[a] < P->InHead[a]) ? P->InTail[a] : P->InHead[a];
+    GroupEnd[k]++;
   }
-
-  for (i=0; i<=n; i++)
+  for (k=1; k<=n; k++) GroupEnd[k] += GroupEnd[k-1];
+  for (a=m; a>=1; a--)
   {
-    P->FirstInDLPtr[i] = 0;
+    k = (P->InTail[a] < P->InHead[a]) ? P->InTail[a] : P->InHead[a];
+    Order[GroupEnd[k]--] = a;
   }
+  /* Group k is now Order[GroupEnd[k]+1],...,Order[GroupEnd[k+1]]. */
+  GroupEnd[n+1] = m;
 
-  for (i=1; i<=n; i++)
-  { /* Insert node i */
-    DL = P->NodePtr[i].DLabel;
+  for (j=1; j<=n; j++) Slot[j] = 0;
+  for (a=1; a<=m; a++) PairOf[a] = 0;
 
-    FirstNode = P->FirstInDLPtr[DL];
-
-    P->NodePtr[i].PrevDLNode = 0;
-    P->NodePtr[i].NextDLNode = FirstNode;
+  for (k=1; k<=n; k++)
+  {
+    /* The arcs (k,j) wait in Slot[j] for an arc (j,k). */
+    for (Pos=GroupEnd[k]+1; Pos<=GroupEnd[k+1]; Pos++)
+    {
+      a = Order[Pos];
+      if (P->InTail[a] != k) continue;
+      j = P->InHead[a];
+      NextInSlot[a] = Slot[j];
+      Slot[j] = a;
+    }
 
-    if (FirstNode > 0)
-    P->NodePtr[FirstNode].PrevDLNode = i;
+    for (Pos=GroupEnd[k]+1; Pos<=GroupEnd[k+1]; Pos++)
+    {
+      a = Order[Pos];
+      if (P->InTail[a] == k) continue;
+      j = P->InTail[a];
+      b = Slot[j];
+      if (b > 0)
+      {
+        Slot[j] = NextInSlot[b];
+        PairOf[a] = b;
+        PairOf[b] = a;
+      }
+    }
 
-    P->FirstInDLPtr[DL] = i;
+    for (Pos=GroupEnd[k]+1; Pos<=GroupEnd[k+1]; Pos++)
+    {
+      a = Order[Pos];
+      if (P->InTail[a] == k) Slot[P->InHead[a]] = 0;
+    }
   }
+
+  MemFree(NextInSlot);
+  MemFree(Order);
 }
 
-void MXF_ComputeDLabels(MaxFlowPtr Ptr,
-                        int Source,
-                        int Sink)
+void MXF_CreateMates(MaxFlowPtr Ptr)
 {
-  int i,n,Index,Tail,Head,Arc;
-  int CurrentLabel,LabeledNodes;
-  char *Labeled;
-  int *Node;
+  int i,a,b,n,m,Arcs;
+  int *PairOf, *ArcTail, *ArcHead, *ArcCap, *ByHead, *NewPos, *Count;
   MXF_Ptr P;
 
   P = (MXF_Ptr) Ptr;
-
-  if ((Source<=0) || (Source>P->NodeListSize) ||
-      (Sink<=0) || (Sink>P->NodeListSize))
-  {
-    printf("Error in input to MXF_ComputeDLabels\n");
-    exit(0);
-  }
-
   n = P->NodeListSize;
+  m = P->ArcListSize;
 
-  Labeled = P->CVWrk1;
-  Node    = P->IVWrk1;
+  PairOf = MemGetIV(m+1);
+  LMXF_PairArcs(P,PairOf);
 
-  for (i=1; i<=n; i++)
+  /* Residual arcs 2p-1 (input arc) and 2p (its mate) of the pair p. */
+  ArcTail = MemGetIV(2*m+1);
+  ArcHead = MemGetIV(2*m+1);
+  ArcCap = MemGetIV(2*m+1);
+
+  Arcs = 0;
+  for (a=1; a<=m; a++)
   {
-    Node[i]              = 0;
-    Labeled[i]           = 0;
-    P->NodePtr[i].DLabel = n;
+    b = PairOf[a];
+    if ((b > 0) && (b < a)) continue;
+
+    ArcTail[Arcs+1] = ArcHead[Arcs+2] = P->InTail[a];
+    ArcHead[Arcs+1] = ArcTail[Arcs+2] = P->InHead[a];
+    ArcCap[Arcs+1] = P->InCap[a];
+    ArcCap[Arcs+2] = (b > 0) ? P->InCap[b] : 0;
+    Arcs += 2;
   }
 
-  P->NodePtr[Sink].DLabel = 0;
-  Labeled[Sink] = 1;
+  if (Arcs > P->ResArcDim)
+  {
+    LMXF_FreeResArcs(P);
+    LMXF_AllocResArcs(P,Arcs);
+  }
+  P->NoOfArcs = Arcs;
 
-  Node[1] = Sink;
-  LabeledNodes = 1;
+  /* Sorted by tail and head: counting sort by head, then a stable
+     counting sort by tail. */
+  ByHead = MemGetIV(Arcs+1);
+  NewPos = MemGetIV(Arcs+1);
+  Count = P->IVWrk1;
 
-  Index = 1;
+  for (i=0; i<=n+1; i++) Count[i] = 0;
+  for (a=1; a<=Arcs; a++) Count[ArcHead[a]]++;
+  for (i=1; i<=n; i++) Count[i] += Count[i-1];
+  for (a=Arcs; a>=1; a--) ByHead[Count[ArcHead[a]]--] = a;
 
-  do
+  for (i=0; i<=n+1; i++) Count[i] = 0;
+  for (a=1; a<=Arcs; a++) Count[ArcTail[a]]++;
+  for (i=1; i<=n; i++) Count[i] += Count[i-1];
+  for (i=1; i<=n+1; i++) P->FirstOut[i] = Count[i-1] + 1;
+  for (i=Arcs; i>=1; i--)
   {
-    Head         = Node[Index];
-    CurrentLabel = P->NodePtr[Head].DLabel + 1;
-
-    Arc  = P->NodePtr[Head].FirstInArc;
-    while (Arc > 0)
-    {
-      Tail = P->ArcPtr[Arc].Tail;
+    a = ByHead[i];
+    NewPos[a] = Count[ArcTail[a]]--;
+  }
 
-      if ((Labeled[Tail]==0) && (P->ArcPtr[Arc].R > 0))
-      {
-        P->NodePtr[Tail].DLabel = CurrentLabel;
-        Labeled[Tail] = 1;
-        Node[++LabeledNodes] = Tail;
-      }
+  for (a=1; a<=Arcs; a++)
+  {
+    b = NewPos[a];
+    P->Tail[b] = ArcTail[a];
+    P->Head[b] = ArcHead[a];
+    P->U[b] = P->R[b] = ArcCap[a]; /* Zero flow */
+    P->Mate[b] = NewPos[(a % 2 == 1) ? a + 1 : a - 1];
+  }
 
-      Arc = P->ArcPtr[Arc].NextInArc;
-    }
+  for (i=1; i<=n; i++) P->Excess[i] = 0;
 
-    Index++;
-  } while (Index <= LabeledNodes);
+  MemFree(PairOf);
+  MemFree(ArcTail);
+  MemFree(ArcHead);
+  MemFree(ArcCap);
+  MemFree(ByHead);
+  MemFree(NewPos);
 
+  P->Built = 1;
 }
 
-
-void MXF_CreateMates(MaxFlowPtr Ptr)
+void MXF_CreateArcMap(MaxFlowPtr Ptr)
 {
-  int i,k,n;
-  int Arc, ReverseArc;
-  int *InArc, *OutArc, *InArcIndex, *OutArcIndex;
-  MXF_Ptr P;
-
-  P = (MXF_Ptr) Ptr;
-  n = P->NodeListSize;
-
-  InArc       = P->IVWrk1;
-  OutArc      = P->IVWrk2;
-  InArcIndex  = P->IVWrk3;
-  OutArcIndex = P->IVWrk4;
-
-  for (i=1; i<=P->ArcListSize; i++) { P->ArcPtr[i].Mate = 0; }
-  for (i=1; i<=n; i++) { InArc[i] = OutArc[i] = 0; }
+  /* Nothing to do: MXF_ChgArcCap finds the arcs in the sorted out-arc lists
+     (the dense map of (Tail,Head) to arc is not needed). */
+  (void) Ptr;
+}
 
-  for (k=1; k<=n; k++)
-  { /* Create mates for node k. */
+static void LMXF_AddToBucket(MXF_Ptr P,
+                             int Node)
+{
+  int DL;
 
-    Arc = P->NodePtr[k].FirstOutArc;
-    while (Arc > 0)
-    {
-      i = P->ArcPtr[Arc].Head;
+  DL = P->DLabel[Node];
+  P->NextBNode[Node] = P->FirstInB[DL];
+  P->FirstInB[DL] = Node;
+  if (DL > P->MaxBLevel) P->MaxBLevel = DL;
+}
 
-      OutArc[i] = k;
-      OutArcIndex[i] = Arc;
-      Arc = P->ArcPtr[Arc].NextOutArc;
-    }
+static void LMXF_AddToDLList(MXF_Ptr P,
+                             int Node)
+{
+  int DL,First;
+
+  DL = P->DLabel[Node];
+  First = P->FirstInDL[DL];
+  P->PrevDLNode[Node] = 0;
+  P->NextDLNode[Node] = First;
+  if (First > 0) P->PrevDLNode[First] = Node;
+  P->FirstInDL[DL] = Node;
+  if (DL > P->MaxDLevel) P->MaxDLevel = DL;
+}
 
-    Arc = P->NodePtr[k].FirstInArc;
-    while (Arc > 0)
-    {
-      i = P->ArcPtr[Arc].Tail;
+static void LMXF_RemoveFromDLList(MXF_Ptr P,
+                                  int Node)
+{
+  int Prev,Next;
 
-      InArc[i] = k;
-      InArcIndex[i] = Arc;
-      Arc = P->ArcPtr[Arc].NextInArc;
-    }
+  Prev = P->PrevDLNode[Node];
+  Next = P->NextDLNode[Node];
+  if (Prev > 0) P->NextDLNode[Prev] = Next;
+  else P->FirstInDL[P->DLabel[Node]] = Next;
+  if (Next > 0) P->PrevDLNode[Next] = Prev;
+}
 
-    /* Scan the lists to find those indices where not both
-       inarc and outarc are present. */
+static void LMXF_ComputeDLabels(MXF_Ptr P,
+                                int Source,
+                                int Sink)
+{
+  /* Exact distance labels: breadth first search from the sink on the reversed
+     residual network. The nodes that cannot reach the sink get label n. */
+  int i,n,Node,Head,Arc,DL,QBegin,QEnd;
 
-    Arc = P->NodePtr[k].FirstOutArc;
-    while (Arc > 0)
-    {
-      i = P->ArcPtr[Arc].Head;
+  n = P->NodeListSize;
 
-      if (InArc[i] != k)
-      {
-        LMXF_AddArc(Ptr,i,k,0,&ReverseArc);
-      }
-      else
-      ReverseArc = InArcIndex[i];
+  for (i=1; i<=n; i++) P->DLabel[i] = n;
 
-      P->ArcPtr[Arc].Mate = ReverseArc;
-      P->ArcPtr[ReverseArc].Mate = Arc;
+  P->DLabel[Sink] = 0;
+  P->Queue[1] = Sink;
+  QBegin = 1;
+  QEnd = 1;
 
-      Arc = P->ArcPtr[Arc].NextOutArc;
-    }
+  while (QBegin <= QEnd)
+  {
+    Node = P->Queue[QBegin++];
+    DL = P->DLabel[Node] + 1;
 
-    Arc = P->NodePtr[k].FirstInArc;
-    while (Arc > 0)
+    for (Arc=P->FirstOut[Node]; Arc<P->FirstOut[Node+1]; Arc++)
     {
-      if (P->ArcPtr[Arc].Mate == 0)
+      Head = P->Head[Arc];
+      if ((P->DLabel[Head] == n) && (P->R[P->Mate[Arc]] > 0) &&
+          (Head != Source))
       {
-        i = P->ArcPtr[Arc].Tail;
-        LMXF_AddArc(Ptr,k,i,0,&ReverseArc);
-
-        P->ArcPtr[Arc].Mate = ReverseArc;
-        P->ArcPtr[ReverseArc].Mate = Arc;
+        P->DLabel[Head] = DL;
+        P->Queue[++QEnd] = Head;
       }
-
-      Arc = P->ArcPtr[Arc].NextInArc;
     }
   }
-
 }
 
-void MXF_CreateArcMap(MaxFlowPtr Ptr)
+static void LMXF_GlobalRelabel(MXF_Ptr P,
+                               int Source,
+                               int Sink)
 {
-  int i,j,Size,Tail,Head;
-  MXF_Ptr P;
-
-  P = (MXF_Ptr) Ptr;
+  int i,n;
 
-  Size = P->NodeListSize;
+  n = P->NodeListSize;
 
-  P->ArcMapPtr = MemGetIM(Size+1,Size+1);
+  LMXF_ComputeDLabels(P,Source,Sink);
 
-  for (i=1; i<=Size; i++)
-  for (j=1; j<=Size; j++)
+  for (i=0; i<n; i++)
   {
-    P->ArcMapPtr[i][j] = 0;
+    P->FirstInB[i] = 0;
+    P->FirstInDL[i] = 0;
   }
+  P->MaxBLevel = 0;
+  P->MaxDLevel = 0;
 
-  for (i=1; i<=P->ArcListSize; i++)
+  for (i=1; i<=n; i++)
   {
-    Tail = P->ArcPtr[i].Tail;
-    Head = P->ArcPtr[i].Head;
+    P->CurrentArc[i] = P->FirstOut[i];
+    if (P->DLabel[i] == n) continue;
 
-    P->ArcMapPtr[Tail][Head] = i;
+    LMXF_AddToDLList(P,i);
+    if ((P->Excess[i] > 0) && (i != Sink)) LMXF_AddToBucket(P,i);
   }
-}
-
-void LMXF_GetCurrentArc(MXF_Ptr P,
-                        int Tail,
-                        int *Arc)
-{
-  /* Returns *Arc = 0 if no admissible arc exists out of Tail. */
-  int Head,Label;
-
-  Label = P->NodePtr[Tail].DLabel - 1;
-  *Arc  = P->NodePtr[Tail].CurrentArc;
-
-  do
-  {
-    Head = P->ArcPtr[*Arc].Head;
-    if ((P->ArcPtr[*Arc].R > 0) && (P->NodePtr[Head].DLabel == Label))
-    {
-      P->NodePtr[Tail].CurrentArc = *Arc;
-      return;
-    }
-    (*Arc) = P->ArcPtr[*Arc].NextOutArc;
-  } while ((*Arc) > 0);
 
-  P->NodePtr[Tail].CurrentArc = 0;
+  P->WorkSinceUpdate = 0;
 }
 
-void LMXF_Push(MXF_Ptr P,
-               int Arc)
+static void LMXF_Gap(MXF_Ptr P,
+                     int Level)
 {
-  int Delta,Tail,Head,Mate;
-
-  Tail = P->ArcPtr[Arc].Tail;
-  Head = P->ArcPtr[Arc].Head;
-  Mate = P->ArcPtr[Arc].Mate;
+  /* No node has label Level: the nodes above it cannot reach the sink. */
+  int i,j,n;
 
-  if (P->NodePtr[Tail].Excess < P->ArcPtr[Arc].R)
-  Delta = P->NodePtr[Tail].Excess;
-  else
-  Delta = P->ArcPtr[Arc].R;
+  n = P->NodeListSize;
 
-  P->NodePtr[Tail].Excess -= Delta;
-  P->ArcPtr[Arc].R -= Delta;
+  for (i=Level+1; i<=P->MaxDLevel; i++)
+  {
+    for (j=P->FirstInDL[i]; j>0; j=P->NextDLNode[j]) P->DLabel[j] = n;
+    P->FirstInDL[i] = 0;
+    P->FirstInB[i] = 0;
+  }
 
-  P->NodePtr[Head].Excess += Delta;
-  P->ArcPtr[Mate].R += Delta;
+  P->MaxDLevel = Level - 1;
+  if (P->MaxBLevel > P->MaxDLevel) P->MaxBLevel = P->MaxDLevel;
 }
 
-void LMXF_ClearBucket(MXF_Ptr P)
+static void LMXF_Relabel(MXF_Ptr P,
+                         int Node)
 {
-  int i,n;
+  int n,Arc,MinArc,MinLabel,OldLabel;
 
   n = P->NodeListSize;
+  OldLabel = P->DLabel[Node];
 
-  for (i=1; i<=n; i++)
+  LMXF_RemoveFromDLList(P,Node);
+  if (P->FirstInDL[OldLabel] == 0)
   {
-    P->NodePtr[i].PrevBNode  = 0;
-    P->NodePtr[i].NextBNode  = 0;
+    P->DLabel[Node] = n;
+    LMXF_Gap(P,OldLabel);
+    return;
   }
 
-  for (i=0; i<=n; i++)
+  MinLabel = n;
+  MinArc = 0;
+  for (Arc=P->FirstOut[Node]; Arc<P->FirstOut[Node+1]; Arc++)
   {
-    P->FirstInBPtr[i]  = 0;
+    if ((P->R[Arc] > 0) && (P->DLabel[P->Head[Arc]] < MinLabel))
+    {
+      MinLabel = P->DLabel[P->Head[Arc]];
+      MinArc = Arc;
+    }
+  }
+  P->WorkSinceUpdate += GR_Beta + P->FirstOut[Node+1] - P->FirstOut[Node];
+
+  if (MinLabel + 1 < n)
+  {
+    P->DLabel[Node] = MinLabel + 1;
+    P->CurrentArc[Node] = MinArc;
+    LMXF_AddToDLList(P,Node);
+  }
+  else
+  {
+    P->DLabel[Node] = n;
   }
 }
 
-void LMXF_AddToBucket(MXF_Ptr P,
-                      int Index,
-                      int Node)
+static void LMXF_Discharge(MXF_Ptr P,
+                           int Node,
+                           int Sink)
 {
-  int FirstNode;
+  int n,Arc,LastArc,Head,DL,Delta;
 
-  FirstNode = P->FirstInBPtr[Index];
+  n = P->NodeListSize;
 
-  P->NodePtr[Node].PrevBNode = 0;
-  P->NodePtr[Node].NextBNode = FirstNode;
+  while (P->DLabel[Node] < n)
+  {
+    DL = P->DLabel[Node] - 1;
+    LastArc = P->FirstOut[Node+1];
 
-  if (FirstNode > 0)
-  P->NodePtr[FirstNode].PrevBNode = Node;
+    for (Arc=P->CurrentArc[Node]; Arc<LastArc; Arc++)
+    {
+      if (P->R[Arc] == 0) continue;
 
-  P->FirstInBPtr[Index] = Node;
-}
+      Head = P->Head[Arc];
+      if (P->DLabel[Head] != DL) continue;
 
-void LMXF_AddToDLList(MXF_Ptr P,
-                      int Index,
-                      int Node)
-{
-  int FirstNode;
+      Delta = P->Excess[Node];
+      if (Delta > P->R[Arc]) Delta = P->R[Arc];
 
-  FirstNode = P->FirstInDLPtr[Index];
+      if ((P->Excess[Head] == 0) && (Head != Sink))
+      LMXF_AddToBucket(P,Head);
 
-  P->NodePtr[Node].PrevDLNode = 0;
-  P->NodePtr[Node].NextDLNode = FirstNode;
+      P->R[Arc] -= Delta;
+      P->R[P->Mate[Arc]] += Delta;
+      P->Excess[Node] -= Delta;
+      P->Excess[Head] += Delta;
 
-  if (FirstNode > 0)
-  P->NodePtr[FirstNode].PrevDLNode = Node;
+      if (P->Excess[Node] == 0) break;
+    }
 
-  P->FirstInDLPtr[Index] = Node;
+    if (Arc < LastArc)
+    {
+      P->CurrentArc[Node] = Arc;
+      return;
+    }
+
+    LMXF_Relabel(P,Node);
+  }
 }
 
-void LMXF_RemoveFromBucket(MXF_Ptr P,
-                           int Index,
-                           int Node)
+static char LMXF_RemoveDeficits(MXF_Ptr P,
+                                int Source,
+                                int Sink)
 {
-  int Prev,Next;
+  /* A node with a negative excess sends more flow than it receives: the
+     flow is cancelled along paths of positive flow from the node to the
+     source, to the sink or to a node with a positive excess.
+     Returns 0 if a deficit could not be removed. */
+  int i,k,n,Node,Arc,Head,Depth,Delta;
+  int *PathNode, *PathArc, *Visited;
 
-  Prev  = P->NodePtr[Node].PrevBNode;
-  Next  = P->NodePtr[Node].NextBNode;
+  n = P->NodeListSize;
+  PathNode = P->IVWrk1;
+  PathArc = P->IVWrk2;
+  Visited = P->IVWrk3;
 
-  P->NodePtr[Node].PrevBNode = 0;
-  P->NodePtr[Node].NextBNode = 0;
+  for (i=1; i<=n; i++) Visited[i] = 0;
 
-  if (Prev > 0) P->NodePtr[Prev].NextBNode = Next;
-  if (Next > 0) P->NodePtr[Next].PrevBNode = Prev;
+  for (i=1; i<=n; i++)
+  {
+    if ((i == Source) || (i == Sink)) continue;
 
-  if (Prev == 0) P->FirstInBPtr[Index] = Next;
-}
+    while (P->Excess[i] < 0)
+    {
+      /* Depth first search; Visited[j] == i marks the nodes on the path and
+         the dead ends of this search. */
+      Depth = 0;
+      PathNode[0] = i;
+      Visited[i] = i;
+      P->CurrentArc[i] = P->FirstOut[i];
+      Head = 0;
+
+      while (Depth >= 0)
+      {
+        Node = PathNode[Depth];
+        for (Arc=P->CurrentArc[Node]; Arc<P->FirstOut[Node+1]; Arc++)
+        {
+          if (P->U[Arc] - P->R[Arc] <= 0) continue; /* No flow */
+          Head = P->Head[Arc];
+          if (Visited[Head] == i) continue;
+          break;
+        }
+        P->CurrentArc[Node] = Arc;
 
-void LMXF_RemoveFromDLList(MXF_Ptr P,
-                           int Index,
-                           int Node)
-{
-  int Prev,Next;
+        if (Arc == P->FirstOut[Node+1])
+        {
+          Visited[Node] = i;
+          Depth--;
+          continue;
+        }
 
-  Prev  = P->NodePtr[Node].PrevDLNode;
-  Next  = P->NodePtr[Node].NextDLNode;
+        PathArc[Depth] = Arc;
+        if ((Head == Source) || (Head == Sink) || (P->Excess[Head] > 0))
+        break;
 
-  P->NodePtr[Node].PrevDLNode = 0;
-  P->NodePtr[Node].NextDLNode = 0;
+        Visited[Head] = i;
+        PathNode[++Depth] = Head;
+        P->CurrentArc[Head] = P->FirstOut[Head];
+      }
 
-  if (Prev > 0) P->NodePtr[Prev].NextDLNode = Next;
-  if (Next > 0) P->NodePtr[Next].PrevDLNode = Prev;
+      if (Depth < 0) return 0;
 
-  if (Prev == 0) P->FirstInDLPtr[Index] = Next;
-}
+      Delta = -P->Excess[i];
+      if ((Head != Source) && (Head != Sink) && (P->Excess[Head] < Delta))
+      Delta = P->Excess[Head];
+      for (k=0; k<=Depth; k++)
+      {
+        Arc = PathArc[k];
+        if (P->U[Arc] - P->R[Arc] < Delta) Delta = P->U[Arc] - P->R[Arc];
+      }
 
+      for (k=0; k<=Depth; k++)
+      {
+        Arc = PathArc[k];
+        P->R[Arc] += Delta;
+        P->R[P->Mate[Arc]] -= Delta;
+      }
+      P->Excess[i] += Delta;
+      P->Excess[Head] -= Delta;
 
-void LMXF_BucketGetMaxLevel(MXF_Ptr P,
-                            int InitLevel,
-                            int *Level)
-{
-  *Level = InitLevel;
-  while (*Level > 0)
-  {
-    if (P->FirstInBPtr[*Level] > 0) return;
-    (*Level)--;
+      /* The marks of this search are reset. */
+      for (k=1; k<=n; k++)
+      if (Visited[k] == i) Visited[k] = 0;
+    }
   }
-}
 
+  return 1;
+}
 
 void MXF_SolveMaxFlow(MaxFlowPtr Ptr,
                       char InitByZeroFlow,
@@ -728,265 +833,72 @@ void MXF_SolveMaxFlow(MaxFlowPtr Ptr,
                       int *NodeList)
 {
   /* CreateMates must be called before calling this routine */
-  char InsertHead;
-  int i,j,n,Node,Tail,Head,Mate,NextInDList,Size,Delta;
-  int Arc;
-  int DLabel,MinLabel,Level,CurrentLevel,ReLabels,ReLabelsLimit;
+  int i,n,Arc,Node,Delta,Size;
+  long GRLimit;
   MXF_Ptr P;
 
   P = (MXF_Ptr) Ptr;
   n = P->NodeListSize;
 
-  for (i=1; i<=n; i++)
-  P->NodePtr[i].CurrentArc = P->NodePtr[i].FirstOutArc;
-
-  if (InitByZeroFlow)
+  if ((Source<=0) || (Source>n) || (Sink<=0) || (Sink>n) ||
+      (P->Built == 0))
   {
-    for (i=1; i<=P->ArcListSize; i++)
-    P->ArcPtr[i].R = P->ArcPtr[i].U; /* Zero flow; Flow equals U-R */
-
-    for (i=1; i<=n; i++) P->NodePtr[i].Excess = 0;
+    printf("Error in input to MXF_SolveMaxFlow\n");
+    exit(0);
   }
 
+  if ((InitByZeroFlow == 0) && (LMXF_RemoveDeficits(P,Source,Sink) == 0))
+  InitByZeroFlow = 1;
+
   if (InitByZeroFlow)
   {
-    MXF_ComputeDLabels(Ptr,Source,Sink);
-    P->NodePtr[Source].DLabel = n;
-
-    MXF_UpdateDLList(Ptr);
-    LMXF_ClearBucket(P);
-
-    Level = 0;
-
-    Tail = Source;
-    Arc = P->NodePtr[Tail].FirstOutArc;
-    while (Arc > 0)
-    {
-      Head = P->ArcPtr[Arc].Head;
-      Mate = P->ArcPtr[Arc].Mate;
-      P->ArcPtr[Arc].R = 0;
-      P->ArcPtr[Mate].R += P->ArcPtr[Arc].U;
-      P->NodePtr[Head].Excess = P->ArcPtr[Arc].U;
-
-      if (P->NodePtr[Head].Excess > 0)
-      {
-        DLabel = P->NodePtr[Head].DLabel;
-        LMXF_AddToBucket(P,DLabel,Head);
-        if (DLabel > Level) Level = DLabel;
-      }
-
-      Arc = P->ArcPtr[Arc].NextOutArc;
-    }
-
-  } /* InitByZeroFlow */
-  else
-  { /* Start from advanced flow */
-
-    /* saturate all arcs out of the source */
-    Tail = Source;
-    Arc = P->NodePtr[Tail].FirstOutArc;
-    while (Arc > 0)
-    {
-      Head = P->ArcPtr[Arc].Head;
-      Mate = P->ArcPtr[Arc].Mate;
-
-      Delta = P->ArcPtr[Arc].R;
-
-      P->NodePtr[Head].Excess += Delta;
-      P->ArcPtr[Arc].R = 0;
-      P->ArcPtr[Mate].R += Delta;
-
-      Arc = P->ArcPtr[Arc].NextOutArc;
-    }
-
-    /* all arcs out of the source are now saturated */
-
-    /* Perform a global relabeling */
-
-    MXF_ComputeDLabels(Ptr,Source,Sink);
-    P->NodePtr[Source].DLabel = n;
-
-    MXF_UpdateDLList(Ptr);
-    LMXF_ClearBucket(P);
-
-    Level = 0;
-
-    for (Node=1; Node<=n; Node++)
-    {
-      if (Node == Sink) continue;
-
-      if (P->NodePtr[Node].Excess > 0)
-      {
-        DLabel = P->NodePtr[Node].DLabel;
+    for (Arc=1; Arc<=P->NoOfArcs; Arc++) P->R[Arc] = P->U[Arc];
+    for (i=1; i<=n; i++) P->Excess[i] = 0;
+  }
 
-        if (DLabel < n)
-        {
-          LMXF_AddToBucket(P,DLabel,Node);
-          if (DLabel > Level) Level = DLabel;
-        }
-      }
+  /* Saturate all arcs out of the source */
+  for (Arc=P->FirstOut[Source]; Arc<P->FirstOut[Source+1]; Arc++)
+  {
+    Delta = P->R[Arc];
+    if (Delta == 0) continue;
 
-      P->NodePtr[Node].CurrentArc = P->NodePtr[Node].FirstOutArc;
-    }
+    P->R[Arc] = 0;
+    P->R[P->Mate[Arc]] += Delta;
+    P->Excess[P->Head[Arc]] += Delta;
+    P->Excess[Source] -= Delta;
   }
 
-  ReLabels = 0;
-  ReLabelsLimit = n;
-
-  BeginMainLoop:
+  LMXF_GlobalRelabel(P,Source,Sink);
+  GRLimit = (long) (GR_Freq * (GR_Alpha * n + P->NoOfArcs));
 
-  while (Level > 0)
+  while (P->MaxBLevel > 0)
   {
-    Tail = P->FirstInBPtr[Level];
-
-    if (Tail == 0)
+    Node = P->FirstInB[P->MaxBLevel];
+    if (Node == 0)
     {
-      /* No active nodes on current level. */
-      Level--;
+      /* No active nodes on the current level. */
+      P->MaxBLevel--;
       continue;
     }
 
-    LMXF_GetCurrentArc(P,Tail,&Arc);
-    if (Arc > 0)
-    {
-      Head = P->ArcPtr[Arc].Head;
-      InsertHead = (P->NodePtr[Head].Excess == 0);
-
-      LMXF_Push(P,Arc);
-      if (P->NodePtr[Tail].Excess == 0)
-      {
-        /* Remove Tail from list of active nodes */
-        LMXF_RemoveFromBucket(P,Level,Tail);
-      }
-
-      if (InsertHead)
-      LMXF_AddToBucket(P,P->NodePtr[Head].DLabel,Head);
-    }
-    else
-    { /* Relabel */
-      ReLabels++;
-      if (ReLabels == ReLabelsLimit)
-      { /* Global Relabeling */
-
-        MXF_ComputeDLabels(Ptr,Source,Sink);
-        P->NodePtr[Source].DLabel = n;
-
-        MXF_UpdateDLList(Ptr);
-        LMXF_ClearBucket(P);
-
-        Level = 0;
-
-        for (Node=1; Node<=n; Node++)
-        {
-          if (Node == Sink) continue;
-
-          if (P->NodePtr[Node].Excess > 0)
-          {
-            DLabel = P->NodePtr[Node].DLabel;
-
-            if (DLabel < n)
-            {
-              LMXF_AddToBucket(P,DLabel,Node);
-              if (DLabel > Level) Level = DLabel;
-            }
-          }
-
-          P->NodePtr[Node].CurrentArc = P->NodePtr[Node].FirstOutArc;
-        }
-
-        ReLabels = 0;
-
-        goto BeginMainLoop;
-      }
-
-
-      MinLabel = n;
-      Arc = P->NodePtr[Tail].FirstOutArc;
-
-      while (Arc > 0)
-      {
-        if (P->ArcPtr[Arc].R > 0)
-        {
-          Head = P->ArcPtr[Arc].Head;
-          if (P->NodePtr[Head].DLabel < MinLabel)
-          MinLabel = P->NodePtr[Head].DLabel;
-        }
-        Arc = P->ArcPtr[Arc].NextOutArc;
-      }
-
-      P->NodePtr[Tail].CurrentArc = P->NodePtr[Tail].FirstOutArc;
-
-      if (MinLabel < n) MinLabel++;
-
-      LMXF_RemoveFromDLList(P,Level,Tail);
-      LMXF_AddToDLList(P,MinLabel,Tail);
-      P->NodePtr[Tail].DLabel = MinLabel;
-
-      LMXF_RemoveFromBucket(P,Level,Tail);
-      if (MinLabel < n) LMXF_AddToBucket(P,MinLabel,Tail);
-
-      /* Check for Gap Relabeling condition: */
-      if (P->FirstInDLPtr[Level] == 0)
-      { /* Gap Relabeling */
-
-        for (i=Level+1; i<n; i++)
-        {
-          j = P->FirstInDLPtr[i];
-          while (j > 0)
-          {
-            NextInDList = P->NodePtr[j].NextDLNode;
-
-            LMXF_RemoveFromDLList(P,i,j);
-            LMXF_AddToDLList(P,n,j);
-
-            if (P->NodePtr[j].Excess > 0)
-            {
-              LMXF_RemoveFromBucket(P,i,j);
-            }
-
-            P->NodePtr[j].DLabel = n;
-
-            j = NextInDList;
-          }
-        }
-
-        CurrentLevel = Level;
-        LMXF_BucketGetMaxLevel(P,CurrentLevel,&Level);
-      }
-      else
-      if (MinLabel < n)
-      {
-        Level = MinLabel;
-      }
-      else
-      {
-        CurrentLevel = Level;
-        LMXF_BucketGetMaxLevel(P,CurrentLevel,&Level);
-      }
-    }
+    P->FirstInB[P->MaxBLevel] = P->NextBNode[Node];
+    LMXF_Discharge(P,Node,Sink);
 
+    if (P->WorkSinceUpdate > GRLimit)
+    LMXF_GlobalRelabel(P,Source,Sink);
   }
 
-  (*CutValue) = P->NodePtr[Sink].Excess;
+  (*CutValue) = P->Excess[Sink];
 
-  MXF_ComputeDLabels(Ptr,Source,Sink);
+  /* The sink side of the minimum cut: the nodes reaching the sink in the
+     residual network (the same set for any maximum preflow). */
+  LMXF_ComputeDLabels(P,Source,Sink);
 
-  Size=0;
-  if (GetSinkSide)
+  Size = 0;
+  for (Node=1; Node<=n; Node++)
   {
-    for (Node=1; Node<=n; Node++)
-    {
-      DLabel = P->NodePtr[Node].DLabel;
-      if (DLabel < n) NodeList[++Size] = Node;
-    }
-  }
-  else
-  {
-    for (Node=1; Node<=n; Node++)
-    {
-      DLabel = P->NodePtr[Node].DLabel;
-      if (DLabel == n) NodeList[++Size] = Node;
-    }
+    if ((P->DLabel[Node] < n) == (GetSinkSide != 0))
+    NodeList[++Size] = Node;
   }
 
   (*NodeListSize) = Size;
@@ -1001,7 +913,7 @@ void MXF_GetNetworkSize(MaxFlowPtr Ptr,
 
   P = (MXF_Ptr) Ptr;
   *Nodes = P->NodeListSize;
-  *Arcs  = P->ArcListSize;
+  *Arcs  = P->NoOfArcs;
 }
 
 void MXF_GetCurrentFlow(MaxFlowPtr Ptr,
@@ -1013,11 +925,11 @@ void MXF_GetCurrentFlow(MaxFlowPtr Ptr,
 
   P = (MXF_Ptr) Ptr;
 
-  for (i=1; i<=P->ArcListSize; i++)
-  ArcResidualCapacity[i] = P->ArcPtr[i].R;
+  for (i=1; i<=P->NoOfArcs; i++)
+  ArcResidualCapacity[i] = P->R[i];
 
   for (i=1; i<=P->NodeListSize; i++)
-  NodeExcess[i] = P->NodePtr[i].Excess;
+  NodeExcess[i] = P->Excess[i];
 }
 
 void MXF_SetFlow(MaxFlowPtr Ptr,
@@ -1029,11 +941,11 @@ void MXF_SetFlow(MaxFlowPtr Ptr,
 
   P = (MXF_Ptr) Ptr;
 
-  for (i=1; i<=P->ArcListSize; i++)
-  P->ArcPtr[i].R = ArcResidualCapacity[i];
+  for (i=1; i<=P->NoOfArcs; i++)
+  P->R[i] = ArcResidualCapacity[i];
 
   for (i=1; i<=P->NodeListSize; i++)
-  P->NodePtr[i].Excess = NodeExcess[i];
+  P->Excess[i] = NodeExcess[i];
 }
 
 void MXF_ComputeGHCutTree(MaxFlowPtr Ptr,
@@ -1049,7 +961,7 @@ void MXF_ComputeGHCutTree(MaxFlowPtr Ptr,
   P = (MXF_Ptr) Ptr;
   n = P->NodeListSize;
 
-  SourceSide = P->IVWrk5;
+  SourceSide = MemGetIV(n+1);
 
   CutValue[CenterNode] = 0;
   for (i=1; i<=n; i++) NextOnPath[i] = CenterNode;
@@ -1092,13 +1004,6 @@ void MXF_ComputeGHCutTree(MaxFlowPtr Ptr,
     }
   }
 
-  /*
-  printf("CenterNode = %d\n",CenterNode);
-  printf("NextOnPath =");
-  for (i=1; i<=n; i++) printf(" %d",NextOnPath[i]);
-  printf("\n");
-  printf("CutValue =");
-  for (i=1; i<=n; i++) printf(" %d",CutValue[i]);
-  */
+  MemFree(SourceSide);
 }
 
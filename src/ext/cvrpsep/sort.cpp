@@ -7,23 +7,14 @@
 
 #include "../../../include/ext/cvrpsep/memmod.h"
 
-int *StackLeft, *StackRight;
-char StacksAllocated = 0;
-
-void SortCheckStacks()
-{
-  if (StacksAllocated) return;
-
-  StackLeft = MemGetIV(50); /* Sufficient for sorting 2^50 numbers!! */
-  StackRight = MemGetIV(50);
-  StacksAllocated = 1;
-}
+/* The partition stacks live on the (thread's) call stack, so the sorting
+   routines are reentrant. */
+#define SORT_STACK_DIM 50 /* Sufficient for sorting 2^50 numbers!! */
 
 void SortIVInc(int *Value, int n)
 {
   int i,j,StackSize,Left,Right,Tmp,KeyValue;
-
-  SortCheckStacks();
+  int StackLeft[SORT_STACK_DIM], StackRight[SORT_STACK_DIM];
 
   StackLeft[1]=1;
   StackRight[1]=n;
@@ -103,8 +94,7 @@ void SortIVInc(int *Value, int n)
 void SortIVDec(int *Value, int n)
 {
   int i,j,StackSize,Left,Right,Tmp,KeyValue;
-
-  SortCheckStacks();
+  int StackLeft[SORT_STACK_DIM], StackRight[SORT_STACK_DIM];
 
   StackLeft[1]=1;
   StackRight[1]=n;
@@ -186,8 +176,7 @@ void SortDVInc(double *Value, int n)
 {
   int i,j,StackSize,Left,Right;
   double Tmp,KeyValue;
-
-  SortCheckStacks();
+  int StackLeft[SORT_STACK_DIM], StackRight[SORT_STACK_DIM];
 
   StackLeft[1]=1;
   StackRight[1]=n;
@@ -269,8 +258,7 @@ void SortDVDec(double *Value, int n)
 {
   int i,j,StackSize,Left,Right;
   double Tmp,KeyValue;
-
-  SortCheckStacks();
+  int StackLeft[SORT_STACK_DIM], StackRight[SORT_STACK_DIM];
 
   StackLeft[1]=1;
   StackRight[1]=n;
@@ -354,8 +342,7 @@ void SortIndexIVInc(int *Index, int *Value, int n)
 
   int i,j,StackSize,Left,Right,Tmp;
   int KeyValue;
-
-  SortCheckStacks();
+  int StackLeft[SORT_STACK_DIM], StackRight[SORT_STACK_DIM];
 
   StackLeft[1]=1;
   StackRight[1]=n;
@@ -435,8 +422,7 @@ void SortIndexIVDec(int *Index, int *Value, int n)
 {
   int i,j,StackSize,Left,Right,Tmp;
   int KeyValue;
-
-  SortCheckStacks();
+  int StackLeft[SORT_STACK_DIM], StackRight[SORT_STACK_DIM];
 
   StackLeft[1]=1;
   StackRight[1]=n;
@@ -519,8 +505,7 @@ void SortIndexDVInc(int *Index, double *Value, int n)
 
   int i,j,StackSize,Left,Right,Tmp;
   double KeyValue;
-
-  SortCheckStacks();
+  int StackLeft[SORT_STACK_DIM], StackRight[SORT_STACK_DIM];
 
   StackLeft[1]=1;
   StackRight[1]=n;
@@ -603,8 +588,7 @@ void SortIndexDVDec(int *Index, double *Value, int n)
 
   int i,j,StackSize,Left,Right,Tmp;
   double KeyValue;
-
-  SortCheckStacks();
+  int StackLeft[SORT_STACK_DIM], StackRight[SORT_STACK_DIM];
 
   StackLeft[1]=1;
   StackRight[1]=n;
@@ -0,0 +1,184 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: spmatrix.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Sparse symmetric matrix (compressed rows) replacing the dense
+ * (n+2)x(n+2) XMatrix/SMatrix of the CAPSEP routines.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 10:40 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "../../../include/ext/cvrpsep/memmod.h"
+#include "../../../include/ext/cvrpsep/spmatrix.h"
+
+static void SPM_ExpandEntries(SparseMatrixPtr P, int NewMaxEntries)
+{
+  P->MaxEntries = NewMaxEntries;
+  P->Col = (int *) MemReGet(P->Col,sizeof(int)*NewMaxEntries);
+  P->Val = (double *) MemReGet(P->Val,sizeof(double)*NewMaxEntries);
+  P->WrkRow = (int *) MemReGet(P->WrkRow,sizeof(int)*NewMaxEntries);
+  P->WrkCol = (int *) MemReGet(P->WrkCol,sizeof(int)*NewMaxEntries);
+  P->WrkPos = (int *) MemReGet(P->WrkPos,sizeof(int)*NewMaxEntries);
+  P->WrkVal = (double *) MemReGet(P->WrkVal,sizeof(double)*NewMaxEntries);
+}
+
+void SPM_InitMem(SparseMatrixPtr *P, int MaxDim, int MaxEntries)
+{
+  if (MaxEntries < 2) MaxEntries = 2;
+
+  (*P) = (SparseMatrixRec *) MemGet(sizeof(SparseMatrixRec));
+  (*P)->Dim = 0;
+  (*P)->MaxDim = MaxDim;
+  (*P)->MaxEntries = MaxEntries;
+  (*P)->NoOfEntries = 0;
+
+  (*P)->RowStart = MemGetIV(MaxDim+2);
+  (*P)->Diag = MemGetDV(MaxDim+1);
+  (*P)->WrkCount = MemGetIV(MaxDim+2);
+
+  (*P)->Col = MemGetIV(MaxEntries);
+  (*P)->Val = MemGetDV(MaxEntries);
+  (*P)->WrkRow = MemGetIV(MaxEntries);
+  (*P)->WrkCol = MemGetIV(MaxEntries);
+  (*P)->WrkPos = MemGetIV(MaxEntries);
+  (*P)->WrkVal = MemGetDV(MaxEntries);
+
+  SPM_Clear(*P,MaxDim);
+  SPM_Finish(*P);
+}
+
+void SPM_FreeMem(SparseMatrixPtr *P)
+{
+  if ((*P) == NULL) return;
+
+  MemFree((*P)->RowStart);
+  MemFree((*P)->Diag);
+  MemFree((*P)->WrkCount);
+  MemFree((*P)->Col);
+  MemFree((*P)->Val);
+  MemFree((*P)->WrkRow);
+  MemFree((*P)->WrkCol);
+  MemFree((*P)->WrkPos);
+  MemFree((*P)->WrkVal);
+  MemFree(*P);
+
+  (*P) = NULL;
+}
+
+void SPM_Clear(SparseMatrixPtr P, int Dim)
+{
+  int i;
+
+  if (Dim > P->MaxDim)
+  {
+    printf("SPM_Clear: Dim = %d > MaxDim = %d\n",Dim,P->MaxDim);
+    exit(0);
+  }
+
+  P->Dim = Dim;
+  P->NoOfEntries = 0;
+  for (i=0; i<=Dim; i++) P->Diag[i] = 0.0;
+}
+
+void SPM_AddSym(SparseMatrixPtr P, int Row, int Col, double X)
+{
+  if (Row == Col)
+  {
+    P->Diag[Row] += X;
+    return;
+  }
+
+  if (P->NoOfEntries + 2 > P->MaxEntries)
+  {
+    SPM_ExpandEntries(P,2 * P->MaxEntries);
+  }
+
+  /* (Row,Col) and (Col,Row) are kept in the order they are added. */
+  P->WrkRow[P->NoOfEntries] = Row;
+  P->WrkCol[P->NoOfEntries] = Col;
+  P->WrkVal[P->NoOfEntries++] = X;
+
+  P->WrkRow[P->NoOfEntries] = Col;
+  P->WrkCol[P->NoOfEntries] = Row;
+  P->WrkVal[P->NoOfEntries++] = X;
+}
+
+void SPM_Finish(SparseMatrixPtr P)
+{
+  int i,k,Idx,Pos,Next,Dim;
+  int *Count;
+
+  Dim = P->Dim;
+  Count = P->WrkCount;
+
+  /* Stable counting sort by column (positions in WrkPos) ... */
+  for (i=0; i<=Dim+1; i++) Count[i] = 0;
+  for (k=0; k<P->NoOfEntries; k++) Count[P->WrkCol[k]+1]++;
+  for (i=1; i<=Dim+1; i++) Count[i] += Count[i-1];
+  for (k=0; k<P->NoOfEntries; k++) P->WrkPos[Count[P->WrkCol[k]]++] = k;
+
+  /* ... then by row: the columns of each row come out increasing, and the
+     duplicates of an entry adjacent and in the order they were added. */
+  for (i=0; i<=Dim+1; i++) Count[i] = 0;
+  for (k=0; k<P->NoOfEntries; k++) Count[P->WrkRow[k]+1]++;
+  for (i=1; i<=Dim+1; i++) Count[i] += Count[i-1];
+  for (i=0; i<=Dim+1; i++) P->RowStart[i] = Count[i];
+
+  for (Idx=0; Idx<P->NoOfEntries; Idx++)
+  {
+    k = P->WrkPos[Idx];
+    Pos = Count[P->WrkRow[k]]++;
+    P->Col[Pos] = P->WrkCol[k];
+    P->Val[Pos] = P->WrkVal[k];
+  }
+
+  /* Merge the duplicates. */
+  Next = 0;
+  for (i=0; i<=Dim; i++)
+  {
+    Pos = P->RowStart[i];
+    P->RowStart[i] = Next;
+    for (k=Pos; k<P->RowStart[i+1]; k++)
+    {
+      if ((Next > P->RowStart[i]) && (P->Col[Next-1] == P->Col[k]))
+      {
+        P->Val[Next-1] += P->Val[k];
+      }
+      else
+      {
+        P->Col[Next] = P->Col[k];
+        P->Val[Next++] = P->Val[k];
+      }
+    }
+  }
+  P->RowStart[Dim+1] = Next;
+  P->NoOfEntries = Next;
+}
+
+double SPM_Get(SparseMatrixPtr P, int Row, int Col)
+{
+  int Lo,Hi,Mid;
+
+  if (Row == Col) return P->Diag[Row];
+
+  Lo = P->RowStart[Row];
+  Hi = P->RowStart[Row+1] - 1;
+  while (Lo <= Hi)
+  {
+    Mid = (Lo + Hi) / 2;
+    if (P->Col[Mid] == Col) return P->Val[Mid];
+    if (P->Col[Mid] < Col) Lo = Mid + 1;
+    else Hi = Mid - 1;
+  }
+
+  return 0.0;
+}
@@ -6,96 +6,144 @@
 #include <stdlib.h>
 
 #include "../../../include/ext/cvrpsep/basegrph.h"
+#include "../../../include/ext/cvrpsep/csrgraph.h"
 #include "../../../include/ext/cvrpsep/strngcmp.h"
 
-int ConnectCallNr;
-int StackSize, ComponentSize;
-int ComponentNr;
-char *OnStack;
-int *NUMBER, *LOWLINK, *Stack, *Component;
-ReachPtr AdjPtr, ResCompPtr;
-
-void StrongConnect(int v)
+/* State of one ComputeStrongComponents call. It is kept on the caller's
+   stack and passed down the recursion (instead of file-scope globals), so
+   that several separations may run concurrently. */
+typedef struct
+{
+  int ConnectCallNr;
+  int StackSize, ComponentSize;
+  int ComponentNr;
+  char *OnStack;
+  int *NUMBER, *LOWLINK, *Stack, *Component;
+  ReachPtr AdjPtr, ResCompPtr;
+  CSRGraphPtr AdjCSRPtr; /* Used instead of AdjPtr if not NULL */
+} StrongCompRec;
+
+static void StrongConnect(StrongCompRec *C, int v)
 {
-  int a,w;
+  int a,w,FirstA,LastA;
+  int *AdjList;
+
+  C->ConnectCallNr++;
 
-  ConnectCallNr++;
+  C->LOWLINK[v]=C->ConnectCallNr;
+  C->NUMBER[v]=C->ConnectCallNr;
 
-  LOWLINK[v]=ConnectCallNr;
-  NUMBER[v]=ConnectCallNr;
+  C->Stack[++C->StackSize]=v;
+  C->OnStack[v]=1;
 
-  Stack[++StackSize]=v;
-  OnStack[v]=1;
+  if (C->AdjCSRPtr != NULL)
+  {
+    FirstA = C->AdjCSRPtr->FirstArc[v];
+    LastA = C->AdjCSRPtr->FirstArc[v+1] - 1;
+    AdjList = C->AdjCSRPtr->ArcHead;
+  }
+  else
+  {
+    FirstA = 1;
+    LastA = C->AdjPtr->LP[v].CFN;
+    AdjList = C->AdjPtr->LP[v].FAL;
+  }
 
-  for (a=1; a<=AdjPtr->LP[v].CFN; a++)
+  for (a=FirstA; a<=LastA; a++)
   {
-    w=AdjPtr->LP[v].FAL[a];
-    if (NUMBER[w]==0)
+    w=AdjList[a];
+    if (C->NUMBER[w]==0)
     {
-      StrongConnect(w);
-      if (LOWLINK[w] < LOWLINK[v]) LOWLINK[v] = LOWLINK[w];
+      StrongConnect(C,w);
+      if (C->LOWLINK[w] < C->LOWLINK[v]) C->LOWLINK[v] = C->LOWLINK[w];
     }
     else
-    if (NUMBER[w] < NUMBER[v])
+    if (C->NUMBER[w] < C->NUMBER[v])
     {
-      if (OnStack[w])
+      if (C->OnStack[w])
       {
-        if (NUMBER[w] < LOWLINK[v]) LOWLINK[v] = NUMBER[w];
+        if (C->NUMBER[w] < C->LOWLINK[v]) C->LOWLINK[v] = C->NUMBER[w];
       }
     }
   }
 
 
-  if (LOWLINK[v]==NUMBER[v])
+  if (C->LOWLINK[v]==C->NUMBER[v])
   {
-    ComponentNr++;
-    ComponentSize=0;
+    C->ComponentNr++;
+    C->ComponentSize=0;
 
-    while ((StackSize > 0) && (NUMBER[Stack[StackSize]] >= NUMBER[v]))
+    while ((C->StackSize > 0) &&
+           (C->NUMBER[C->Stack[C->StackSize]] >= C->NUMBER[v]))
     {
-      OnStack[Stack[StackSize]]=0;
-      Component[++ComponentSize]=Stack[StackSize--];
+      C->OnStack[C->Stack[C->StackSize]]=0;
+      C->Component[++C->ComponentSize]=C->Stack[C->StackSize--];
     }
 
-    ReachSetForwList(ResCompPtr,Component,ComponentNr,ComponentSize);
+    ReachSetForwList(C->ResCompPtr,C->Component,C->ComponentNr,
+                     C->ComponentSize);
   }
 
 }
 
 
-void ComputeStrongComponents(ReachPtr RPtr, ReachPtr ResultPtr,
-                             int *NoOfComponents, int n,
-                             char *CVWrk1,
-                             int *IVWrk1, int *IVWrk2, int *IVWrk3,
-                             int *IVWrk4)
+static void LComputeStrongComponents(ReachPtr RPtr, CSRGraphPtr GPtr,
+                                     ReachPtr ResultPtr,
+                                     int *NoOfComponents, int n,
+                                     char *CVWrk1,
+                                     int *IVWrk1, int *IVWrk2, int *IVWrk3,
+                                     int *IVWrk4)
 {
   int i;
+  StrongCompRec C;
 
-  OnStack = CVWrk1;
+  C.OnStack = CVWrk1;
 
-  NUMBER  = IVWrk1;
-  LOWLINK = IVWrk2;
-  Stack   = IVWrk3;
-  Component = IVWrk4;
+  C.NUMBER  = IVWrk1;
+  C.LOWLINK = IVWrk2;
+  C.Stack   = IVWrk3;
+  C.Component = IVWrk4;
 
   for (i=1; i<=n; i++)
   {
-    NUMBER[i]=0;
-    OnStack[i]=0;
+    C.NUMBER[i]=0;
+    C.OnStack[i]=0;
   }
 
-  ConnectCallNr = 0;
-  StackSize = 0;
-  ComponentNr = 0;
+  C.ConnectCallNr = 0;
+  C.StackSize = 0;
+  C.ComponentSize = 0;
+  C.ComponentNr = 0;
 
-  AdjPtr = RPtr;
-  ResCompPtr = ResultPtr;
+  C.AdjPtr = RPtr;
+  C.AdjCSRPtr = GPtr;
+  C.ResCompPtr = ResultPtr;
 
   for (i=1; i<=n; i++)
   {
-    if (NUMBER[i]==0)
-    StrongConnect(i);
+    if (C.NUMBER[i]==0)
+    StrongConnect(&C,i);
   }
 
-  *NoOfComponents = ComponentNr;
+  *NoOfComponents = C.ComponentNr;
+}
+
+void ComputeStrongComponents(ReachPtr RPtr, ReachPtr ResultPtr,
+                             int *NoOfComponents, int n,
+                             char *CVWrk1,
+                             int *IVWrk1, int *IVWrk2, int *IVWrk3,
+                             int *IVWrk4)
+{
+  LComputeStrongComponents(RPtr,NULL,ResultPtr,NoOfComponents,n,
+                           CVWrk1,IVWrk1,IVWrk2,IVWrk3,IVWrk4);
+}
+
+void ComputeStrongComponentsCSR(CSRGraphPtr GPtr, ReachPtr ResultPtr,
+                                int *NoOfComponents, int n,
+                                char *CVWrk1,
+                                int *IVWrk1, int *IVWrk2, int *IVWrk3,
+                                int *IVWrk4)
+{
+  LComputeStrongComponents(NULL,GPtr,ResultPtr,NoOfComponents,n,
+                           CVWrk1,IVWrk1,IVWrk2,IVWrk3,IVWrk4);
 }
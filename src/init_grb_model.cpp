@@ -15,9 +15,11 @@
  */
 ////////////////////////////////////////////////////////////////////////////////
 
+#include <algorithm>
 #include <bitset>
+#include <chrono>
 #include <cmath>
-#include <sstream>
+#include <string>
 
 #include "../include/ext/loguru/loguru.hpp"
 
@@ -48,9 +50,135 @@ std::vector<int> findSetS(const int idx, const int nbVertices)
     return inS;
 }
 
+/* Adds a family of variables with a single addVars() call (unnamed, see
+   init::variableNames()) and copies them to block[0..lb.size() - 1]. */
+void addVarsBlock(GRBModel& model,
+                  const std::vector<double>& lb,
+                  const std::vector<double>& ub,
+                  const std::vector<double>& obj,
+                  const char type,
+                  GRBVar* block)
+{
+    DCHECK_F(ub.size() == lb.size() && obj.size() == lb.size());
+
+    const std::vector<char> types(lb.size(), type);
+    std::unique_ptr<GRBVar[]> added(model.addVars(lb.data(),
+                                                  ub.data(),
+                                                  obj.data(),
+                                                  types.data(),
+                                                  nullptr,
+                                                  static_cast<int>(lb.size())));
+    std::copy(added.get(), added.get() + lb.size(), block);
+}
+
 } // anonymous namespace
 
 
+void init::ConstrNames::addKey(const char* prefix,
+                               std::initializer_list<int> ids)
+{
+    if (mPrefixes.empty() || mPrefixes.back() != prefix)
+    {
+        mPrefixes.push_back(prefix);
+    }
+
+    mKeyPrefix.push_back(static_cast<int>(mPrefixes.size()) - 1);
+    mKeyBegin.push_back(mIds.size());
+    mIds.insert(mIds.end(), ids);
+}
+
+
+void init::ConstrNames::addConstrs(const GRBConstr* pConstrs,
+                                   const std::size_t nbConstrs)
+{
+    mConstrs.insert(mConstrs.end(), pConstrs, pConstrs + nbConstrs);
+    DCHECK_F(mConstrs.size() == mKeyPrefix.size());
+}
+
+
+void init::ConstrNames::setNames(GRBModel& model)
+{
+    DCHECK_F(mConstrs.size() == mKeyPrefix.size());
+    if (mConstrs.empty()) return;
+
+    std::vector<std::string> names;
+    names.reserve(mConstrs.size());
+    for (std::size_t c = 0; c < mConstrs.size(); ++c)
+    {
+        const std::size_t end =
+            c + 1 < mKeyBegin.size() ? mKeyBegin[c + 1] : mIds.size();
+
+        std::string name = mPrefixes[mKeyPrefix[c]];
+        for (std::size_t i = mKeyBegin[c]; i < end; ++i)
+        {
+            if (i > mKeyBegin[c]) name += '_';
+            name += std::to_string(mIds[i]);
+        }
+        names.push_back(std::move(name));
+    }
+
+    model.set(GRB_StringAttr_ConstrName, mConstrs.data(), names.data(),
+              static_cast<int>(mConstrs.size()));
+
+    *this = ConstrNames();
+}
+
+
+init::ConstrBatch::ConstrBatch(const std::string& family,
+                               ConstrNames& names,
+                               const std::size_t nbRows) :
+    mFamily(family),
+    mNames(names),
+    mStart(std::chrono::steady_clock::now())
+{
+    mExprs.reserve(nbRows);
+    mSenses.reserve(nbRows);
+    mRHS.reserve(nbRows);
+}
+
+
+void init::ConstrBatch::endRow(const char sense,
+                               const double rhs,
+                               const char* prefix,
+                               std::initializer_list<int> ids)
+{
+    mExprs.emplace_back();
+    mExprs.back().addTerms(mCoeffs.data(),
+                           mVars.data(),
+                           static_cast<int>(mCoeffs.size()));
+    mSenses.push_back(sense);
+    mRHS.push_back(rhs);
+    mCoeffs.clear();
+    mVars.clear();
+
+    mNames.addKey(prefix, ids);
+}
+
+
+void init::ConstrBatch::addToModel(GRBModel& model,
+                                   std::vector<GRBConstr>* pConstrs)
+{
+    std::unique_ptr<GRBConstr[]> added(
+        model.addConstrs(mExprs.data(),
+                         mSenses.data(),
+                         mRHS.data(),
+                         nullptr,
+                         static_cast<int>(mExprs.size())));
+    mNames.addConstrs(added.get(), mExprs.size());
+    if (pConstrs)
+    {
+        pConstrs->insert(pConstrs->end(),
+                         added.get(),
+                         added.get() + mExprs.size());
+    }
+
+    RAW_LOG_F(INFO, "\t%s constraints: %zu rows in %.3f s",
+              mFamily.c_str(), mExprs.size(),
+              std::chrono::duration<double>(
+                  std::chrono::steady_clock::now() - mStart).count());
+}
+
+
 void init::inventoryLevelVariables(
     GRBModel& model,
     std::vector<std::vector<GRBVar>>& I,
@@ -58,311 +186,357 @@ void init::inventoryLevelVariables(
 {
     DRAW_LOG_F(INFO, "\tinitializing inventory level variables (I_it)");
 
+    const int nbPeriods = pInst->getT() + 1;
+    std::vector<double> lb(pInst->getNbVertices() * nbPeriods, 0);
+    std::vector<double> ub;
+    std::vector<double> obj;
+    ub.reserve(lb.size());
+    obj.reserve(lb.size());
+    for (auto i = 0; i < pInst->getNbVertices(); ++i)
+    {
+        ub.insert(ub.end(), nbPeriods, i == 0 ? GRB_INFINITY : pInst->getUi(i));
+        obj.insert(obj.end(), nbPeriods, pInst->get_hi(i));
+    }
+
+    std::vector<GRBVar> block(lb.size());
+    addVarsBlock(model, lb, ub, obj, GRB_CONTINUOUS, block.data());
+
     I.reserve(pInst->getNbVertices());
     for (auto i = 0; i < pInst->getNbVertices(); ++i)
     {
-        I.push_back(std::vector<GRBVar>());
-        I[i].reserve(pInst->getT() + 1);
-        for (auto t = 0; t <= pInst->getT(); ++t)
-        {
-            std::ostringstream oss;
-            oss << "I_" << i << "_" << t;
-            I[i].push_back(model.addVar(0,
-                                        i == 0 ? GRB_INFINITY : pInst->getUi(i),
-                                        pInst->get_hi(i),
-                                        GRB_CONTINUOUS,
-                                        oss.str()));
-        }
+        I.emplace_back(block.begin() + i * nbPeriods,
+                       block.begin() + (i + 1) * nbPeriods);
     }
 }
 
 void init::quantityVariables(GRBModel& model,
-                             std::vector<std::vector<std::vector<GRBVar>>>& q,
+                             std::vector<GRBVar>& vars,
+                             const VarIndex& idx,
                              const std::shared_ptr<const Instance>& pInst)
 {
     DRAW_LOG_F(INFO, "\tinitializing quantity delivered variables (q_it)");
 
-    q.reserve(pInst->getNbVertices());
-    for (auto i = 0; i < pInst->getNbVertices(); ++i)
-    {
-        q.push_back(std::vector<std::vector<GRBVar>>());
-        q[i].reserve(pInst->getK());
-
-        for (auto k = 0; k < pInst->getK(); ++k)
-        {
-            q[i].push_back(std::vector<GRBVar>(pInst->getT() + 1));
-
-            if (i == 0) continue;
+    const int nbq = (pInst->getNbVertices() - 1) * pInst->getK() *
+        pInst->getT();
+    DCHECK_F(nbq == idx.getNbq());
 
-            for (auto t = 0; t < pInst->getT(); ++t)
-            {
-                std::ostringstream oss;
-                oss << "q_" << i << "_" << k << "_" << t;
-                q[i][k][t] = model.addVar(0,
-                                    GRB_INFINITY,
-                                    0,
-                                    GRB_CONTINUOUS,
-                                    oss.str());
-            }
-        }
-    }
+    const std::vector<double> lb(nbq, 0);
+    const std::vector<double> ub(nbq, GRB_INFINITY);
+    const std::vector<double> obj(nbq, 0);
+    addVarsBlock(model, lb, ub, obj, GRB_CONTINUOUS,
+                 vars.data() + idx.q(1, 0, 0));
 }
 
 
 void init::visitationVariables(GRBModel& model,
-                               std::vector<std::vector<std::vector<GRBVar>>>& y,
+                               std::vector<GRBVar>& vars,
+                               const VarIndex& idx,
                                const std::shared_ptr<const Instance>& pInst)
 {
     DRAW_LOG_F(INFO, "\tinitializing visitation variables (y_it)");
 
-    y.reserve(pInst->getNbVertices());
+    const int nby = pInst->getNbVertices() * pInst->getK() * pInst->getT();
+    DCHECK_F(nby == idx.getNby());
+
+    const std::vector<double> lb(nby, 0);
+    const std::vector<double> ub(nby, 1);
+    const std::vector<double> obj(nby, 0);
+    addVarsBlock(model, lb, ub, obj, GRB_BINARY, vars.data() + idx.y(0, 0, 0));
+}
+
+
+void init::routingVariables(GRBModel& model,
+                            std::vector<GRBVar>& vars,
+                            const VarIndex& idx,
+                            const std::shared_ptr<const Instance>& pInst)
+{
+    DRAW_LOG_F(INFO, "\tinitializing routing variables (x_ijt)");
+
+    /* only the upper triangle (i < j) exists; the (k, t) blocks repeat the
+       bounds and costs of the edges */
+    std::vector<double> edgeUb(idx.getNbEdges());
+    std::vector<double> edgeObj(idx.getNbEdges());
     for (auto i = 0; i < pInst->getNbVertices(); ++i)
     {
-        y.push_back(std::vector<std::vector<GRBVar>>());
-        y[i].reserve(pInst->getK());
-        for (auto k = 0; k < pInst->getK(); ++k)
+        for (auto j = i + 1; j < pInst->getNbVertices(); ++j)
         {
-            y[i].push_back(std::vector<GRBVar>(pInst->getT() + 1));
-            for (auto t = 0; t < pInst->getT(); ++t)
-            {
-                std::ostringstream oss;
-                oss << "y_" << i << "_" << k << "_" << t;
-                y[i][k][t] = model.addVar(0, 1, 0, GRB_BINARY, oss.str());
-            }
+            edgeUb[idx.edge(i, j)] = i == 0 ? 2 : 1;
+            edgeObj[idx.edge(i, j)] = pInst->get_cij(i, j);
         }
     }
+
+    const std::vector<double> lb(idx.getNbx(), 0);
+    std::vector<double> ub;
+    std::vector<double> obj;
+    ub.reserve(idx.getNbx());
+    obj.reserve(idx.getNbx());
+    for (auto b = 0; b < pInst->getK() * pInst->getT(); ++b)
+    {
+        ub.insert(ub.end(), edgeUb.begin(), edgeUb.end());
+        obj.insert(obj.end(), edgeObj.begin(), edgeObj.end());
+    }
+
+    addVarsBlock(model, lb, ub, obj, GRB_INTEGER,
+                 vars.data() + idx.xBegin(0, 0));
 }
 
 
-void init::routingVariables(
-    GRBModel& model,
-    std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
-    const std::shared_ptr<const Instance>& pInst)
+void init::variableNames(GRBModel& model,
+                         const std::vector<std::vector<GRBVar>>& I,
+                         const std::vector<GRBVar>& vars,
+                         const VarIndex& idx,
+                         const std::shared_ptr<const Instance>& pInst)
 {
-    DRAW_LOG_F(INFO, "\tinitializing routing variables (x_ijt)");
+    std::vector<GRBVar> named;
+    std::vector<std::string> names;
+    named.reserve(vars.size() + I.size() * (pInst->getT() + 1));
+    names.reserve(named.capacity());
+
+    const auto name = [](const char* prefix, std::initializer_list<int> ids)
+    {
+        std::string s(prefix);
+        for (auto id : ids)
+        {
+            s += '_';
+            s += std::to_string(id);
+        }
+        return s;
+    };
 
-    x.reserve(pInst->getNbVertices());
     for (auto i = 0; i < pInst->getNbVertices(); ++i)
     {
-        x.push_back(std::vector<std::vector<std::vector<GRBVar>>>());
-        x[i].reserve(pInst->getNbVertices());
-        for (auto j = 0; j < pInst->getNbVertices(); ++j)
+        for (auto t = 0; t <= pInst->getT(); ++t)
         {
-            x[i].push_back(std::vector<std::vector<GRBVar>>());
-            x[i][j].reserve(pInst->getK());
+            named.push_back(I[i][t]);
+            names.push_back(name("I", {i, t}));
+        }
+    }
 
-            for (auto k = 0; k < pInst->getK(); ++k)
+    for (auto k = 0; k < pInst->getK(); ++k)
+    {
+        for (auto t = 0; t < pInst->getT(); ++t)
+        {
+            for (auto i = 0; i < pInst->getNbVertices(); ++i)
             {
-                x[i][j].push_back(std::vector<GRBVar>(pInst->getT() + 1));
-                if (j <= i) continue;
+                if (i > 0)
+                {
+                    named.push_back(vars[idx.q(i, k, t)]);
+                    names.push_back(name("q", {i, k, t}));
+                }
+                named.push_back(vars[idx.y(i, k, t)]);
+                names.push_back(name("y", {i, k, t}));
 
-                for (auto t = 0; t < pInst->getT(); ++t)
+                for (auto j = i + 1; j < pInst->getNbVertices(); ++j)
                 {
-                    std::ostringstream oss;
-                    oss << "x_" << i << "_" << j << "_" << k << "_" << t;
-                    x[i][j][k][t] = model.addVar(0,
-                                                 (i == 0 ? 2 : 1),
-                                                 pInst->get_cij(i, j),
-                                                 GRB_INTEGER,
-                                                 oss.str());
+                    named.push_back(vars[idx.x(i, j, k, t)]);
+                    names.push_back(name("x", {i, j, k, t}));
                 }
             }
         }
     }
+
+    model.set(GRB_StringAttr_VarName, named.data(), names.data(),
+              static_cast<int>(named.size()));
 }
 
 
-// ok
 void init::inventoryDefDepotConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing inventory definition depot constraints");
+    ConstrBatch b("inventory definition depot", names,
+                  pInst->getT() + 1);
 
-    constrs.push_back(model.addConstr(I[0][0] == pInst->getIi0(0), "1C_0"));
+    b.addTerm(1, I[0][0]);
+    b.endRow(GRB_EQUAL, pInst->getIi0(0), "1C_", {0});
     for (auto t = 1; t <= pInst->getT(); ++t)
     {
-        GRBLinExpr e = I[0][t - 1] + pInst->get_rit(0, t - 1);
+        /* I_0t = I_0t-1 + r_0t-1 - sum_ik q_ikt-1 */
+        b.addTerm(1, I[0][t]);
+        b.addTerm(-1, I[0][t - 1]);
         for (auto i = 1; i < pInst->getNbVertices(); ++i) // skip depot
         {
             for (auto k = 0; k < pInst->getK(); ++k)
             {
-                e -= q[i][k][t - 1];
+                b.addTerm(1, vars[idx.q(i, k, t - 1)]);
             }
         }
-
-        std::ostringstream oss;
-        oss << "1C_" << t;
-        constrs.push_back(model.addConstr(I[0][t] == e, oss.str()));
+        b.endRow(GRB_EQUAL, pInst->get_rit(0, t - 1), "1C_", {t});
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
-// ok
 void init::stockOutDepotConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing stockout depot contraints");
+    ConstrBatch b("stockout depot", names, pInst->getT());
 
     for (auto t = 0; t < pInst->getT(); ++t)
     {
-        GRBLinExpr e = 0;
+        /* I_0t >= sum_ik q_ikt */
+        b.addTerm(1, I[0][t]);
         for (int i = 1; i < pInst->getNbVertices(); i++)
         {
             for (auto k = 0; k < pInst->getK(); ++k)
             {
-                e += q[i][k][t];
+                b.addTerm(-1, vars[idx.q(i, k, t)]);
             }
         }
-
-        std::ostringstream oss;
-        oss << "2C_" << t;
-        constrs.push_back(model.addConstr(I[0][t] >= e, oss.str()));
+        b.endRow(GRB_GREATER_EQUAL, 0, "2C_", {t});
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
-// ok
 void init::inventoryDefCustomersConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing inventory definition customers contraints");
+    ConstrBatch b("inventory definition customers", names,
+                  (pInst->getNbVertices() - 1) * (pInst->getT() + 1));
 
     for (auto i = 1; i < pInst->getNbVertices(); ++i)
     {
-        std::ostringstream oss;
-        oss << "3C_" << i;
-        constrs.push_back(
-            model.addConstr(I[i][0] == pInst->getIi0(i), oss.str()));
+        b.addTerm(1, I[i][0]);
+        b.endRow(GRB_EQUAL, pInst->getIi0(i), "3C_", {i});
 
         for (auto t = 1; t <= pInst->getT(); ++t)
         {
-            GRBLinExpr e = 0;
+            /* I_it = I_it-1 + sum_k q_ikt-1 - r_it-1 */
+            b.addTerm(1, I[i][t]);
+            b.addTerm(-1, I[i][t - 1]);
             for (auto k = 0; k < pInst->getK(); ++k)
             {
-                e += q[i][k][t - 1];
+                b.addTerm(-1, vars[idx.q(i, k, t - 1)]);
             }
-
-            e += I[i][t - 1] - pInst->get_rit(i, t - 1);
-
-            oss.clear();
-            oss.str("");
-            oss << "3C_" << i << "_" << t;
-            constrs.push_back(model.addConstr(I[i][t] == e, oss.str()));
+            b.endRow(GRB_EQUAL, -pInst->get_rit(i, t - 1), "3C_", {i, t});
         }
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
-// ok
 void init::inventoryLevelConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing inventory level constraints");
+    ConstrBatch b("inventory level", names, pInst->getT());
 
     for (int t = 0; t < pInst->getT(); ++t)
     {
-        GRBLinExpr e = 0;
+        /* I_0t >= sum_ik q_ikt */
+        b.addTerm(1, I[0][t]);
         for (int i = 1; i < pInst->getNbVertices(); ++i)
         {
             for (auto k = 0; k < pInst->getK(); ++k)
             {
-                e += q[i][k][t];
+                b.addTerm(-1, vars[idx.q(i, k, t)]);
             }
         }
-
-        std::ostringstream oss;
-        oss << "5C_" << t;
-        constrs.push_back(model.addConstr(I[0][t] >= e, oss.str()));
+        b.endRow(GRB_GREATER_EQUAL, 0, "5C_", {t});
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
-// ok
 void init::mlQuantityCapacityConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tML quantity capacity constraints");
+    ConstrBatch b("ML quantity capacity", names,
+                  (pInst->getNbVertices() - 1) * pInst->getT());
 
     for (auto i = 1; i < pInst->getNbVertices(); ++i)
     {
         for (auto t = 0; t < pInst->getT(); ++t)
         {
-            GRBLinExpr e = 0;
+            /* sum_k q_ikt <= U_i - I_it */
             for (auto k = 0; k < pInst->getK(); ++k)
             {
-                e += q[i][k][t];
+                b.addTerm(1, vars[idx.q(i, k, t)]);
             }
-
-            std::ostringstream oss;
-            oss << "6C_ML" << i << "_" << t;
-            constrs.push_back(
-                model.addConstr(e <= pInst->getUi(i) - I[i][t], oss.str()));
+            b.addTerm(1, I[i][t]);
+            b.endRow(GRB_LESS_EQUAL, pInst->getUi(i), "6C_ML", {i, t});
         }
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
-// ok
 void init::ouQuantityCapacityConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
     const std::vector<std::vector<GRBVar>>& I,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tOU quantity capacity constraints");
+    ConstrBatch b("OU quantity capacity", names,
+                  (pInst->getNbVertices() - 1) * pInst->getT());
 
     for (auto i = 1; i < pInst->getNbVertices(); ++i)
     {
         for (auto t = 0; t < pInst->getT(); ++t)
         {
-            GRBLinExpr e1 = 0;
-            GRBLinExpr e2 = 0;
+            /* sum_k q_ikt >= U_i sum_k y_ikt - I_it */
             for (int k = 0; k < pInst->getK(); ++k)
             {
-                e1 += q[i][k][t];
-                e2 += y[i][k][t];
+                b.addTerm(1, vars[idx.q(i, k, t)]);
+                b.addTerm(-pInst->getUi(i), vars[idx.y(i, k, t)]);
             }
-
-            std::ostringstream oss;
-            oss << "6C_OU" << i << "_" << t;
-            constrs.push_back(model.addConstr(e1 >=
-                pInst->getUi(i) * e2 - I[i][t], oss.str()));
+            b.addTerm(1, I[i][t]);
+            b.endRow(GRB_GREATER_EQUAL, 0, "6C_OU", {i, t});
         }
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
-// ok
 void init::quantitiesRoutingConstraint(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing quantities routing constraints");
+    ConstrBatch b("quantities routing", names,
+                  (pInst->getNbVertices() - 1) * pInst->getK() *
+                  pInst->getT());
 
     for (auto i = 1; i < pInst->getNbVertices(); ++i)
     {
@@ -370,54 +544,56 @@ void init::quantitiesRoutingConstraint(
         {
             for (auto t = 0; t < pInst->getT(); ++t)
             {
-                std::ostringstream oss;
-                oss << "7C" << i << "_" << k << "_" << t;
-                constrs.push_back(model.addConstr(q[i][k][t] <=
-                                pInst->getUi(i) * y[i][k][t], oss.str()));
+                /* q_ikt <= U_i y_ikt */
+                b.addTerm(1, vars[idx.q(i, k, t)]);
+                b.addTerm(-pInst->getUi(i), vars[idx.y(i, k, t)]);
+                b.endRow(GRB_LESS_EQUAL, 0, "7C", {i, k, t});
             }
         }
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
-// ok
 void init::capacityVehicleConstraint(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<GRBVar>>>& q,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing capacity vehicles constraints");
+    ConstrBatch b("capacity vehicles", names, pInst->getK() * pInst->getT());
 
     for (int k = 0; k < pInst->getK(); ++k)
     {
         for (auto t = 0; t < pInst->getT(); ++t)
         {
-            GRBLinExpr e = 0;
+            /* sum_i q_ikt <= C_k y_0kt */
             for (auto i = 1; i < pInst->getNbVertices(); ++i)
             {
-                e += q[i][k][t];
+                b.addTerm(1, vars[idx.q(i, k, t)]);
             }
-
-            std::ostringstream oss;
-            oss << "8C_" << k << "_" << t;
-            constrs.push_back(
-                model.addConstr(e <= pInst->getCk(k) * y[0][k][t], oss.str()));
+            b.addTerm(-pInst->getCk(k), vars[idx.y(0, k, t)]);
+            b.endRow(GRB_LESS_EQUAL, 0, "8C_", {k, t});
         }
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
-// ok
 void init::degreeConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing degree constraints");
+    ConstrBatch b("degree", names,
+                  pInst->getNbVertices() * pInst->getK() * pInst->getT());
 
     for (auto k = 0; k < pInst->getK(); ++k)
     {
@@ -425,36 +601,34 @@ void init::degreeConstrs(
         {
             for (auto i = 0; i < pInst->getNbVertices(); ++i)
             {
-                GRBLinExpr e1 = 0;
-                for (auto j = i + 1; j < pInst->getNbVertices(); ++j)
+                /* sum_j x_ijkt (edges of i) = 2 y_ikt */
+                for (auto j = 0; j < i; ++j)
                 {
-                    e1 += x[i][j][k][t];
+                    b.addTerm(1, vars[idx.x(j, i, k, t)]);
                 }
-
-                GRBLinExpr e2 = 0;
-                for (auto j = 0; j < i; ++j)
+                for (auto j = i + 1; j < pInst->getNbVertices(); ++j)
                 {
-                    e2 += x[j][i][k][t];
+                    b.addTerm(1, vars[idx.x(i, j, k, t)]);
                 }
-
-                std::ostringstream oss;
-                oss << "9C_" << i << "_" << k << "_" << t;
-                constrs.push_back(
-                    model.addConstr(e1 + e2 == 2 * y[i][k][t], oss.str()));
+                b.addTerm(-2, vars[idx.y(i, k, t)]);
+                b.endRow(GRB_EQUAL, 0, "9C_", {i, k, t});
             }
         }
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
 void init::subtourEliminationConstrs(
     GRBModel& model,
     std::vector<GRBConstr>& constrs,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing subtour elimination constraints");
+    ConstrBatch b("subtour elimination", names, 0);
 
     const auto nbSets = std::pow(2, pInst->getNbVertices() - 1);
     for (int c = 1; c < nbSets; ++c)
@@ -468,54 +642,55 @@ void init::subtourEliminationConstrs(
                 {
                     for (auto m : S)
                     {
-                        GRBLinExpr lhs = 0;
-                        GRBLinExpr rhs = 0;
+                        /* sum_{i < j in S} x_ijkt <= sum_{i in S \ m} y_ikt */
                         for (auto i : S)
                         {
                             for (auto j : S)
                             {
                                 if (i < j)
                                 {
-                                    lhs += x[i][j][k][t];
+                                    b.addTerm(1, vars[idx.x(i, j, k, t)]);
                                 }
                             }
-                            rhs += y[i][k][t];
-                        }
 
-                        rhs -= y[m][k][t];
-
-                        std::ostringstream oss;
-                        oss << "5CB_" << c << "_" << k << "_" << t << "_" << m;
-                        constrs.push_back(model.addConstr(lhs <= rhs,
-                                          oss.str()));
+                            if (i != m)
+                            {
+                                b.addTerm(-1, vars[idx.y(i, k, t)]);
+                            }
+                        }
+                        b.endRow(GRB_LESS_EQUAL, 0, "5CB_", {c, k, t, m});
                     }
-                } 
+                }
             }
         }
     }
+
+    b.addToModel(model, &constrs);
 }
 
 
 void init::noSplitDelivery(
     GRBModel& model,
-    const std::vector<std::vector<std::vector<GRBVar>>>& y,
-    const std::shared_ptr<const Instance>& pInst)
+    const std::vector<GRBVar>& vars,
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst,
+    init::ConstrNames& names)
 {
-    DRAW_LOG_F(INFO, "\tinitializing no split delivery constraints");
+    ConstrBatch b("no split delivery", names,
+                  pInst->getT() * (pInst->getNbVertices() - 1));
 
     for (int t = 0; t < pInst->getT(); ++t)
     {
         for (int i = 1; i < pInst->getNbVertices(); ++i)
         {
-            GRBLinExpr e = 0;
+            /* sum_k y_ikt <= 1 */
             for (int k = 0; k < pInst->getK(); ++k)
             {
-                e += y[i][k][t];
+                b.addTerm(1, vars[idx.y(i, k, t)]);
             }
-
-            std::ostringstream oss;
-            oss << "10C_" << t << "_" << i;
-            model.addConstr(e <= 1, oss.str());
+            b.endRow(GRB_LESS_EQUAL, 1, "10C_", {t, i});
         }
     }
-}
\ No newline at end of file
+
+    b.addToModel(model, nullptr);
+}
@@ -24,6 +24,7 @@
 
 #include "../include/irp_lp.hpp"
 #include "../include/init_grb_model.hpp"
+#include "../include/valid_inequalities.hpp"
 
 //////////////////////////////// Helper methods ////////////////////////////////
 
@@ -33,10 +34,10 @@ namespace
 
 void initModel(GRBModel& model,
                std::vector<std::vector<GRBVar>>& I,
-               std::vector<std::vector<std::vector<GRBVar>>>& q,
-               std::vector<std::vector<std::vector<std::vector<GRBVar>>>>& x,
-               std::vector<std::vector<std::vector<GRBVar>>>& y,
+               std::vector<GRBVar>& vars,
+               const VarIndex& idx,
                std::vector<GRBConstr>& constrs,
+               init::ConstrNames& constrNames,
                CallbackSEC &CbSEC,
                const std::shared_ptr<const Instance>& pInst,
                const ConfigParameters::model& params)
@@ -47,31 +48,39 @@ void initModel(GRBModel& model,
     {
         /* Initialize variables */
         init::inventoryLevelVariables(model, I, pInst);
-        init::quantityVariables(model, q, pInst);
-        init::visitationVariables(model, y, pInst);
-        init::routingVariables(model, x, pInst);
+        init::quantityVariables(model, vars, idx, pInst);
+        init::visitationVariables(model, vars, idx, pInst);
+        init::routingVariables(model, vars, idx, pInst);
         
         /* Iniialize constraints */
-        init::inventoryDefDepotConstrs(model, constrs, I, q, pInst);
-        init::inventoryDefCustomersConstrs(model, constrs, I, q, pInst);
-        init::inventoryLevelConstrs(model, constrs, I, q, pInst);
-        init::quantitiesRoutingConstraint(model, constrs, y, q, pInst);
-        init::capacityVehicleConstraint(model, constrs, y, q, pInst);
-        init::degreeConstrs(model, constrs, y, x, pInst);
-        init::noSplitDelivery(model, y, pInst);
+        init::inventoryDefDepotConstrs(model, constrs, I, vars, idx, pInst,
+                                       constrNames);
+        init::inventoryDefCustomersConstrs(model, constrs, I, vars, idx,
+                                           pInst, constrNames);
+        init::inventoryLevelConstrs(model, constrs, I, vars, idx, pInst,
+                                    constrNames);
+        init::quantitiesRoutingConstraint(model, constrs, vars, idx, pInst,
+                                          constrNames);
+        init::capacityVehicleConstraint(model, constrs, vars, idx, pInst,
+                                        constrNames);
+        init::degreeConstrs(model, constrs, vars, idx, pInst, constrNames);
+        init::noSplitDelivery(model, vars, idx, pInst, constrNames);
 
         /* define which policy should be use */
         switch (params.policy)
         {
         case ConfigParameters::model::policy_opt::ML :
         {
-            init::mlQuantityCapacityConstrs(model, constrs, I, q, pInst);
+            init::mlQuantityCapacityConstrs(model, constrs, I, vars, idx,
+                                            pInst, constrNames);
             break;
         }
         case ConfigParameters::model::policy_opt::OU :
         {
-            init::mlQuantityCapacityConstrs(model, constrs, I, q, pInst);
-            init::ouQuantityCapacityConstrs(model, constrs, I, y, q, pInst);
+            init::mlQuantityCapacityConstrs(model, constrs, I, vars, idx,
+                                            pInst, constrNames);
+            init::ouQuantityCapacityConstrs(model, constrs, I, vars, idx,
+                                            pInst, constrNames);
             break;
         }
         default:
@@ -85,7 +94,8 @@ void initModel(GRBModel& model,
         {
         case ConfigParameters::model::sec_opt::STD :
         {
-            init::subtourEliminationConstrs(model, constrs, y, x, pInst);
+            init::subtourEliminationConstrs(model, constrs, vars, idx, pInst,
+                                            constrNames);
             break;
         }
         case ConfigParameters::model::sec_opt::CVRPSEP :
@@ -96,6 +106,37 @@ void initModel(GRBModel& model,
             break;
         }
         }
+
+        /* valid inequalities: added to the model or separated by the callback
+           (only installed with the CVRPSEP strategy) */
+        using vi_opt = ConfigParameters::model::vi_opt;
+        const std::vector<std::pair<ValidInequalities::family, vi_opt>> vis = {
+            {ValidInequalities::family::depotEdge, params.vi_depot_edge},
+            {ValidInequalities::family::depotVisit, params.vi_depot_visit},
+            {ValidInequalities::family::minVisits, params.vi_min_visits},
+            {ValidInequalities::family::inventory, params.vi_inventory}};
+        const bool hasCallback =
+            params.sec_strategy == ConfigParameters::model::sec_opt::CVRPSEP;
+
+        ValidInequalities staticVis(idx, pInst);
+        for (const auto& [f, opt] : vis)
+        {
+            if (opt == vi_opt::CUT && hasCallback)
+            {
+                CbSEC.addValidIneqFamily(f);
+            }
+            else if (opt != vi_opt::OFF)
+            {
+                staticVis.addFamily(f);
+            }
+        }
+        staticVis.addToModel(model, constrs, vars, constrNames);
+
+        /* otherwise the constraints are named by the write methods */
+        if (params.names)
+        {
+            constrNames.setNames(model);
+        }
     }
     catch (GRBException e)
     {
@@ -116,9 +157,13 @@ Irp_lp::Irp_lp(const std::shared_ptr<const Instance>& pInst,
                const ConfigParameters::model& params) :
     mpInst(pInst),
     mModel(mEnv),
-    mCbSEC(m_q, m_x, m_y, pInst)
+    mIdx(pInst->getNbVertices(), pInst->getK(), pInst->getT()),
+    mVars(mIdx.size()),
+    mNamed(false),
+    mCbSEC(mVars, mIdx, pInst)
 {
-    initModel(mModel, mI, m_q, m_x, m_y, mConstrs, mCbSEC, mpInst, params);
+    initModel(mModel, mI, mVars, mIdx, mConstrs, mConstrNames, mCbSEC, mpInst,
+              params);
 }
 
 
@@ -134,8 +179,19 @@ bool Irp_lp::solve(const ConfigParameters::solver& params)
         mModel.set(GRB_DoubleParam_TimeLimit, params.time_limit);
         mModel.set(GRB_IntParam_Threads, params.nb_threads);
         mModel.set(GRB_StringParam_LogFile, params.logFile_);
+        mCbSEC.setNbSepThreads(params.sep_nb_threads);
+        mCbSEC.setAggregatedSep(params.sep_aggregated);
+        mCbSEC.setSepPropagation(params.sep_propagate);
+        mCbSEC.setSepScheduler(params.sep_node_freq,
+                               params.sep_min_violation,
+                               params.sep_backoff_gain);
+        mCbSEC.setExactSep(params.sep_exact_nodes);
+        mCbSEC.setCutFamilies(params.sep_cap,
+                              params.sep_mstar,
+                              params.sep_qcap);
 
         mModel.optimize();
+        mCbSEC.showStats();
 
         if (mModel.get(GRB_IntAttr_Status) == GRB_INFEASIBLE)
         {
@@ -163,6 +219,7 @@ void Irp_lp::writeIis(std::string path)
 
     try
     {
+        nameModel();
         mModel.computeIIS();
         mModel.write(path);
     }
@@ -184,6 +241,7 @@ void Irp_lp::writeModel(std::string path)
 
     try
     {
+        nameModel();
         mModel.write(path);
     }
     catch (GRBException& e)
@@ -200,12 +258,15 @@ void Irp_lp::writeModel(std::string path)
 void Irp_lp::writeResultsJSON(std::string path)
 {
     DCHECK_F(std::filesystem::is_directory(path), "dir does not exists");
+    const std::string statsPath = path + mpInst->getName() + "_sep_stats.json";
     path += mpInst->getName() + ".json";
 
     try
     {
+        nameModel();
         mModel.set(GRB_IntParam_JSONSolDetail, 1);
         mModel.write(path);
+        mCbSEC.writeStatsJSON(statsPath);
     }
     catch (GRBException& e)
     {
@@ -225,6 +286,7 @@ void Irp_lp::writeSolution(std::string path)
 
     try
     {
+        nameModel();
         mModel.write(path);
     }
     catch (GRBException& e)
@@ -235,4 +297,15 @@ void Irp_lp::writeSolution(std::string path)
     {
         RAW_LOG_F(ERROR, "writeSolution(): Unknown Exception");
     }
+}
+
+/////////////////////////////// private methods ////////////////////////////////
+
+void Irp_lp::nameModel()
+{
+    if (mNamed) return;
+
+    init::variableNames(mModel, mI, mVars, mIdx, mpInst);
+    mConstrNames.setNames(mModel);
+    mNamed = true;
 }
\ No newline at end of file
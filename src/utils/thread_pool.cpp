@@ -0,0 +1,117 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: thread_pool.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief Fixed-size pool of worker threads for fork-join loops, class
+ * definition.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 10:05 AM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include "../../include/utils/thread_pool.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+
+utils::ThreadPool::ThreadPool(const std::size_t nbThreads) :
+    mpTask(nullptr),
+    mNbTasks(0),
+    mNextTask(0),
+    mNbBusy(0),
+    mGeneration(0),
+    mStop(false)
+{
+    const std::size_t nbWorkers = nbThreads > 1 ? nbThreads - 1 : 0;
+    mWorkers.reserve(nbWorkers);
+    for (std::size_t i = 0; i < nbWorkers; ++i)
+    {
+        mWorkers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+
+utils::ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mStop = true;
+    }
+    mCvWork.notify_all();
+
+    for (auto& w : mWorkers)
+    {
+        w.join();
+    }
+}
+
+
+std::size_t utils::ThreadPool::getNbThreads() const
+{
+    return mWorkers.size() + 1;
+}
+
+
+void utils::ThreadPool::parallelFor(const int nbTasks,
+                                    const std::function<void(int)>& task)
+{
+    if (nbTasks <= 0) return;
+
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mpTask = &task;
+        mNbTasks = nbTasks;
+        mNextTask = 0;
+        mNbBusy = mWorkers.size();
+        ++mGeneration;
+    }
+    mCvWork.notify_all();
+
+    runTasks();
+
+    std::unique_lock<std::mutex> lock(mMutex);
+    mCvDone.wait(lock, [this]{ return mNbBusy == 0; });
+    mpTask = nullptr;
+}
+
+/////////////////////////////// private methods ////////////////////////////////
+
+void utils::ThreadPool::workerLoop()
+{
+    std::size_t lastGeneration = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(mMutex);
+            mCvWork.wait(lock, [this, lastGeneration]{
+                return mStop || mGeneration != lastGeneration; });
+
+            if (mStop) return;
+            lastGeneration = mGeneration;
+        }
+
+        runTasks();
+
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            --mNbBusy;
+        }
+        mCvDone.notify_one();
+    }
+}
+
+
+void utils::ThreadPool::runTasks()
+{
+    int i = mNextTask++;
+    while (i < mNbTasks)
+    {
+        (*mpTask)(i);
+        i = mNextTask++;
+    }
+}
@@ -0,0 +1,245 @@
+////////////////////////////////////////////////////////////////////////////////
+/*
+ * File: valid_inequalities.cpp
+ * Author: Guilherme O. Chagas
+ *
+ * @brief IRP valid inequalities (added to the model or separated as user
+ * cuts), class definition.
+ *
+ * (I'm sorry for my bad english xD)
+ *
+ * Created on October 17, 2026, 08:15 PM
+ *
+ * References:
+ */
+////////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cmath>
+
+#include "../include/ext/loguru/loguru.hpp"
+
+#include "../include/valid_inequalities.hpp"
+
+//////////////////////////////// Helper methods ////////////////////////////////
+
+namespace
+{
+
+// tolerance of the rounding up of the minimum number of visits
+static const double cRoundEps = 1e-6;
+
+} // anonymous namespace
+
+////////////////////////////////////////////////////////////////////////////////
+
+ValidInequalities::ValidInequalities(
+    const VarIndex& idx,
+    const std::shared_ptr<const Instance>& pInst) :
+    mIdx(idx),
+    mpInst(pInst)
+{}
+
+
+void ValidInequalities::addFamily(const family f)
+{
+    const std::size_t nbBefore = mRows.size();
+
+    switch (f)
+    {
+    case family::depotEdge: addDepotEdge(); break;
+    case family::depotVisit: addDepotVisit(); break;
+    case family::minVisits: addMinVisits(); break;
+    case family::inventory: addInventory(); break;
+    }
+
+    RAW_LOG_F(INFO, "\t%zu valid inequalities (%s)", mRows.size() - nbBefore,
+              getName(f).c_str());
+}
+
+
+bool ValidInequalities::empty() const
+{
+    return mRows.empty();
+}
+
+
+void ValidInequalities::addToModel(GRBModel& model,
+                                   std::vector<GRBConstr>& constrs,
+                                   const std::vector<GRBVar>& vars,
+                                   init::ConstrNames& names) const
+{
+    std::vector<std::string> prefixes;
+    for (int f = 0; f < nbFamilies; ++f)
+    {
+        prefixes.push_back("VI_" + getName(static_cast<family>(f)) + "_");
+    }
+
+    init::ConstrBatch b("valid inequalities", names, mRows.size());
+    for (std::size_t c = 0; c < mRows.size(); ++c)
+    {
+        const auto& r = mRows[c];
+        for (std::size_t i = 0; i < r.ind.size(); ++i)
+        {
+            b.addTerm(r.val[i], vars[r.ind[i]]);
+        }
+        b.endRow(GRB_LESS_EQUAL, r.rhs,
+                 prefixes[static_cast<int>(r.f)].c_str(),
+                 {static_cast<int>(c)});
+    }
+
+    b.addToModel(model, &constrs);
+}
+
+
+std::string ValidInequalities::getName(const family f)
+{
+    switch (f)
+    {
+    case family::depotEdge: return "depot_edge";
+    case family::depotVisit: return "depot_visit";
+    case family::minVisits: return "min_visits";
+    case family::inventory: return "inventory";
+    }
+    return "";
+}
+
+/////////////////////////////// private methods ////////////////////////////////
+
+void ValidInequalities::addRow(const family f,
+                               std::vector<int>&& ind,
+                               std::vector<double>&& val,
+                               const double rhs)
+{
+    DCHECK_F(ind.size() == val.size());
+    mRows.push_back({f, std::move(ind), std::move(val), rhs});
+}
+
+
+void ValidInequalities::addDepotEdge()
+{
+    for (int i = 1; i < mpInst->getNbVertices(); ++i)
+    {
+        for (int k = 0; k < mpInst->getK(); ++k)
+        {
+            for (int t = 0; t < mpInst->getT(); ++t)
+            {
+                addRow(family::depotEdge,
+                       {mIdx.x(0, i, k, t), mIdx.y(i, k, t)},
+                       {1, -2},
+                       0);
+            }
+        }
+    }
+}
+
+
+void ValidInequalities::addDepotVisit()
+{
+    for (int i = 1; i < mpInst->getNbVertices(); ++i)
+    {
+        for (int k = 0; k < mpInst->getK(); ++k)
+        {
+            for (int t = 0; t < mpInst->getT(); ++t)
+            {
+                addRow(family::depotVisit,
+                       {mIdx.y(i, k, t), mIdx.y(0, k, t)},
+                       {1, -1},
+                       0);
+            }
+        }
+    }
+}
+
+
+void ValidInequalities::addMinVisits()
+{
+    double maxCk = 0;
+    for (int k = 0; k < mpInst->getK(); ++k)
+    {
+        maxCk = std::max(maxCk, mpInst->getCk(k));
+    }
+
+    for (int i = 1; i < mpInst->getNbVertices(); ++i)
+    {
+        // maximum quantity delivered in one visit
+        const double maxQ = std::min(mpInst->getUi(i), maxCk);
+
+        for (int t1 = 0; t1 < mpInst->getT(); ++t1)
+        {
+            /* stock at the beginning of t1 */
+            const double stock = t1 == 0 ? mpInst->getIi0(i) : mpInst->getUi(i);
+
+            double demand = 0;
+            for (int t2 = t1; t2 < mpInst->getT(); ++t2)
+            {
+                demand += mpInst->get_rit(i, t2);
+
+                const double minVisits =
+                    std::ceil((demand - stock) / maxQ - cRoundEps);
+                if (minVisits < 1) continue;
+
+                std::vector<int> ind;
+                for (int t = t1; t <= t2; ++t)
+                {
+                    for (int k = 0; k < mpInst->getK(); ++k)
+                    {
+                        ind.push_back(mIdx.y(i, k, t));
+                    }
+                }
+                std::vector<double> val(ind.size(), -1);
+                addRow(family::minVisits,
+                       std::move(ind),
+                       std::move(val),
+                       -minVisits);
+            }
+        }
+    }
+}
+
+
+void ValidInequalities::addInventory()
+{
+    /* -sum_{t < t1} sum_k q_ikt - r_i(t1, t2) sum_{t1..t2} sum_k y_ikt <=
+       I_i0 - sum_{t < t1} r_it - r_i(t1, t2) */
+    for (int i = 1; i < mpInst->getNbVertices(); ++i)
+    {
+        double consumed = 0; // sum_{t < t1} r_it
+        for (int t1 = 0; t1 < mpInst->getT(); ++t1)
+        {
+            double demand = 0;
+            for (int t2 = t1; t2 < mpInst->getT(); ++t2)
+            {
+                demand += mpInst->get_rit(i, t2);
+
+                /* the initial stock alone covers the window */
+                if (t1 == 0 && mpInst->getIi0(i) >= demand) continue;
+                if (demand <= 0) continue;
+
+                std::vector<int> ind;
+                std::vector<double> val;
+                for (int t = 0; t < t1; ++t)
+                {
+                    for (int k = 0; k < mpInst->getK(); ++k)
+                    {
+                        ind.push_back(mIdx.q(i, k, t));
+                        val.push_back(-1);
+                    }
+                }
+                for (int t = t1; t <= t2; ++t)
+                {
+                    for (int k = 0; k < mpInst->getK(); ++k)
+                    {
+                        ind.push_back(mIdx.y(i, k, t));
+                        val.push_back(-demand);
+                    }
+                }
+                addRow(family::inventory,
+                       std::move(ind),
+                       std::move(val),
+                       mpInst->getIi0(i) - consumed - demand);
+            }
+            consumed += mpInst->get_rit(i, t1);
+        }
+    }
+}